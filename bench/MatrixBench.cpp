@@ -0,0 +1,74 @@
+#include <SDLPP/Matrix.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <vector>
+#include <SDL3/SDL_timer.h>
+
+static constexpr std::size_t Count = 1 << 16;
+static constexpr int Iterations = 50;
+
+static volatile float sink;
+
+static double Measure(const std::function<float()> &function) {
+    sink = function();
+    const Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < Iterations; ++i)
+        sink = function();
+    const Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+    return static_cast<double>(elapsed) * 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency()) / Iterations;
+}
+
+template <typename Matrix>
+static std::vector<Matrix> MakeMatrices(const std::size_t size) {
+    std::vector<Matrix> matrices(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+        for (std::size_t j = 0; j < size * size; ++j)
+            matrices[i][j] = static_cast<float>((i + j) % 7) * 0.25f;
+    return matrices;
+}
+
+template <typename Matrix>
+static float Multiply(const std::vector<Matrix> &matrices) {
+    Matrix result = Matrix::Identity;
+    for (const Matrix &matrix : matrices)
+        result = result * matrix * 0.5f;
+    return result[0];
+}
+
+template <typename Matrix>
+static float SumChecked(const std::vector<Matrix> &matrices, const std::size_t size) {
+    float sum = 0;
+    for (const Matrix &matrix : matrices)
+        for (std::size_t y = 0; y < size; ++y)
+            for (std::size_t x = 0; x < size; ++x)
+                sum += matrix(x, y);
+    return sum;
+}
+
+template <typename Matrix>
+static float SumUnchecked(const std::vector<Matrix> &matrices, const std::size_t size) {
+    float sum = 0;
+    for (const Matrix &matrix : matrices)
+        for (std::size_t y = 0; y < size; ++y)
+            for (std::size_t x = 0; x < size; ++x)
+                sum += matrix.At(x, y);
+    return sum;
+}
+
+template <typename Matrix>
+static void Run(const char *name, const std::size_t size) {
+    const std::vector<Matrix> matrices = MakeMatrices<Matrix>(size);
+    const double multiply = Measure([&] { return Multiply(matrices); });
+    const double checked = Measure([&] { return SumChecked(matrices, size); });
+    const double unchecked = Measure([&] { return SumUnchecked(matrices, size); });
+    std::printf("%s  multiply %8.3f ms   operator() %8.3f ms   At %8.3f ms   %5.2fx\n", name, multiply, checked, unchecked,
+        checked / unchecked);
+}
+
+int main() {
+    Run<SDL::FMatrix3x3>("Matrix3x3", 3);
+    Run<SDL::FMatrix4x4>("Matrix4x4", 4);
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <SDLPP/SDLPP.hpp>
+
+#include "PixelKernels.hpp"
+
+#include <cstdio>
+#include <functional>
+#include <SDL3/SDL_timer.h>
+
+SDL_InitFlags SDL::Init::flags = 0;
+
+static constexpr int Width = 3840;
+static constexpr int Height = 2160;
+static constexpr int Iterations = 20;
+
+static double Measure(const std::function<void()> &function) {
+    function();
+    const Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < Iterations; ++i)
+        function();
+    const Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+    return static_cast<double>(elapsed) * 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency()) / Iterations;
+}
+
+static void Report(const char *name, const double sdlpp, const char *baselineName, const double baseline) {
+    std::printf("%-20s SDLPP %8.3f ms   %-6s %8.3f ms   %5.2fx\n", name, sdlpp, baselineName, baseline, baseline / sdlpp);
+}
+
+int main() {
+    SDL::Surface surface({Width, Height}, SDL_PIXELFORMAT_ARGB8888);
+    SDL::Surface scratch({Width, Height}, SDL_PIXELFORMAT_ARGB8888);
+    const SDL::Color color(40, 80, 120, 160);
+    const Uint32 pixel = surface.MapRGBA(color);
+    const SDL_Rect rect{1, 1, Width - 2, Height - 2};
+
+    const std::size_t count = static_cast<std::size_t>(surface.Get()->pitch / 4) * Height;
+    auto *pixels = static_cast<Uint32 *>(surface.Get()->pixels);
+    const SDL::Color colorMod(200, 100, 50);
+    const Uint8 alphaMod = 128;
+    const Uint32 colorFactors = 0xFF000000 | static_cast<Uint32>(colorMod.r) << 16 | static_cast<Uint32>(colorMod.g) << 8 | colorMod.b;
+    const Uint32 alphaFactors = 0x00FFFFFF | static_cast<Uint32>(alphaMod) << 24;
+
+    Report("Clear",
+        Measure([&] { surface.Clear(color); }),
+        "SDL", Measure([&] { SDL_ClearSurface(surface.Get(), color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f); }));
+
+    Report("FillRect",
+        Measure([&] { surface.FillRect(SDL::Rect<>(rect), pixel); }),
+        "SDL", Measure([&] { SDL_FillSurfaceRect(surface.Get(), &rect, pixel); }));
+
+    const double premultiply = Measure([&] {
+        surface.Clear(color);
+        surface.PremultiplyAlpha(false);
+    });
+    Report("PremultiplyAlpha", premultiply, "scalar", Measure([&] {
+        surface.Clear(color);
+        SDL::PixelKernels::PremultiplyScalar(pixels, count, 24);
+    }));
+    Report("PremultiplyAlpha", premultiply, "SDL", Measure([&] {
+        surface.Clear(color);
+        SDL_PremultiplySurfaceAlpha(surface.Get(), false);
+    }));
+
+    Report("UnpremultiplyAlpha",
+        Measure([&] {
+            surface.Clear(color);
+            surface.UnpremultiplyAlpha();
+        }),
+        "scalar", Measure([&] {
+            surface.Clear(color);
+            SDL::PixelKernels::UnpremultiplyScalar(pixels, count, 24);
+        }));
+
+    const double bakeColorMod = Measure([&] {
+        surface.Clear(color);
+        surface.SetColorMod(colorMod);
+        surface.BakeColorMod();
+    });
+    Report("BakeColorMod", bakeColorMod, "scalar", Measure([&] {
+        surface.Clear(color);
+        SDL::PixelKernels::ModulateScalar(pixels, count, colorFactors);
+    }));
+    Report("BakeColorMod", bakeColorMod, "SDL", Measure([&] {
+        surface.Clear(color);
+        surface.SetColorMod(colorMod);
+        surface.SetBlendMode(SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(surface.Get(), nullptr, scratch.Get(), nullptr);
+        surface.SetColorMod(SDL::Color::White);
+    }));
+
+    const double bakeAlphaMod = Measure([&] {
+        surface.Clear(color);
+        surface.SetAlphaMod(alphaMod);
+        surface.BakeAlphaMod();
+    });
+    Report("BakeAlphaMod", bakeAlphaMod, "scalar", Measure([&] {
+        surface.Clear(color);
+        SDL::PixelKernels::ModulateScalar(pixels, count, alphaFactors);
+    }));
+    Report("BakeAlphaMod", bakeAlphaMod, "SDL", Measure([&] {
+        surface.Clear(color);
+        surface.SetAlphaMod(alphaMod);
+        surface.SetBlendMode(SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(surface.Get(), nullptr, scratch.Get(), nullptr);
+        surface.SetAlphaMod(255);
+    }));
+    return 0;
+}
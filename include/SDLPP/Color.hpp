@@ -17,6 +17,9 @@ namespace SDL {
         Color &operator+=(const Color &other);
         Color &operator-=(const Color &other);
 
+        bool operator==(const Color &other) const;
+        bool operator!=(const Color &other) const;
+
         [[nodiscard]] Uint32 AsInt() const;
 
         operator SDL_Color() const;
@@ -0,0 +1,49 @@
+#ifndef COMMANDLIST_HPP
+#define COMMANDLIST_HPP
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+#include <SDL3/SDL_render.h>
+
+#include "Texture.hpp"
+#include "Vertex.hpp"
+
+namespace SDL {
+    class Shape;
+
+    class CommandList {
+    public:
+        struct Command {
+            SDL_Texture *texture;
+            std::size_t vertexOffset;
+            int vertexCount;
+            std::size_t indexOffset;
+            int indexCount;
+        };
+
+        CommandList();
+        // Like VertexBuffer, a list built on a FrameArena is only valid until the arena is reset.
+        explicit CommandList(std::pmr::memory_resource *resource);
+
+        void Draw(const SDL_Vertex *vertices, int vertexCount, const Texture &texture = nullptr);
+        void Draw(const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount, const Texture &texture = nullptr);
+        void Draw(const VertexBuffer &vertices, const Texture &texture = nullptr);
+        // Only reads the shape's cached geometry, so the shape must already be up to date (e.g. GetBoundingBox() called
+        // on the thread that modifies it) before recording from another thread. Debug builds assert this.
+        void Draw(const Shape &shape);
+
+        void Clear();
+
+        [[nodiscard]] bool Empty() const;
+        [[nodiscard]] std::size_t CommandCount() const;
+        [[nodiscard]] const std::pmr::vector<Command> &GetCommands() const;
+        [[nodiscard]] const SDL_Vertex *GetVertices(const Command &command) const;
+        [[nodiscard]] const int *GetIndices(const Command &command) const;
+    private:
+        std::pmr::vector<SDL_Vertex> _vertices;
+        std::pmr::vector<int> _indices;
+        std::pmr::vector<Command> _commands;
+    };
+}
+
+#endif //COMMANDLIST_HPP
@@ -0,0 +1,37 @@
+#ifndef FONT_HPP
+#define FONT_HPP
+#include <string>
+#include <unordered_map>
+#include <SDL3/SDL_stdinc.h>
+
+#include "TextureAtlas.hpp"
+#include "Vector.hpp"
+
+namespace SDL {
+    class Renderer;
+
+    class Font {
+    public:
+        struct Glyph {
+            TextureAtlas::Region region;
+            FVector2 offset;
+            float advance;
+        };
+
+        Font(const Renderer &renderer, const std::string &file, const UVector2 &atlasSize = {1024, 1024});
+
+        [[nodiscard]] const Glyph *GetGlyph(Uint32 codepoint) const;
+        [[nodiscard]] float GetKerning(Uint32 first, Uint32 second) const;
+        [[nodiscard]] float GetLineHeight() const;
+        [[nodiscard]] float GetBase() const;
+        [[nodiscard]] const TextureAtlas &GetAtlas() const;
+    private:
+        TextureAtlas _atlas;
+        std::unordered_map<Uint32, Glyph> _glyphs;
+        std::unordered_map<Uint64, float> _kerning;
+        float _lineHeight = 0;
+        float _base = 0;
+    };
+}
+
+#endif //FONT_HPP
@@ -0,0 +1,40 @@
+#ifndef FRAMEARENA_HPP
+#define FRAMEARENA_HPP
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace SDL {
+    class FrameArena final : public std::pmr::memory_resource {
+    public:
+        explicit FrameArena(std::size_t blockSize = 64 * 1024);
+
+        FrameArena(const FrameArena &) = delete;
+        FrameArena &operator=(const FrameArena &) = delete;
+
+        void Reset();
+        void Release();
+
+        [[nodiscard]] std::size_t GetUsed() const;
+        [[nodiscard]] std::size_t GetCapacity() const;
+        [[nodiscard]] std::size_t GetBlockCount() const;
+    private:
+        struct Block {
+            std::unique_ptr<std::byte[]> data;
+            std::size_t size;
+        };
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const memory_resource &other) const noexcept override;
+
+        std::size_t _blockSize;
+        std::vector<Block> _blocks;
+        std::size_t _block = 0;
+        std::size_t _offset = 0;
+        std::size_t _used = 0;
+    };
+}
+
+#endif //FRAMEARENA_HPP
@@ -2,6 +2,7 @@
 #define MATRIX_HPP
 #include <initializer_list>
 #include <stdexcept>
+#include <string>
 
 #include "Vector.hpp"
 
@@ -42,7 +43,7 @@ namespace SDL {
             if (x >= 3)
                 throw std::out_of_range("x (which is " + std::to_string(x) + ") >= width (which is 3)");
             if (y >= 3)
-                throw std::out_of_range("y (which is " + std::to_string(x) + ") >= height (which is 3)");
+                throw std::out_of_range("y (which is " + std::to_string(y) + ") >= height (which is 3)");
             return _data[x + y * 3];
         }
 
@@ -50,10 +51,26 @@ namespace SDL {
             if (x >= 3)
                 throw std::out_of_range("x (which is " + std::to_string(x) + ") >= width (which is 3)");
             if (y >= 3)
-                throw std::out_of_range("y (which is " + std::to_string(x) + ") >= height (which is 3)");
+                throw std::out_of_range("y (which is " + std::to_string(y) + ") >= height (which is 3)");
             return _data[x + y * 3];
         }
 
+        [[nodiscard]] constexpr const T &At(const std::size_t x, const std::size_t y) const noexcept {
+            return _data[x + y * 3];
+        }
+
+        [[nodiscard]] constexpr T &At(const std::size_t x, const std::size_t y) noexcept {
+            return _data[x + y * 3];
+        }
+
+        [[nodiscard]] constexpr const T &operator[](const std::size_t i) const noexcept {
+            return _data[i];
+        }
+
+        [[nodiscard]] constexpr T &operator[](const std::size_t i) noexcept {
+            return _data[i];
+        }
+
         [[nodiscard]] constexpr const T &operator()(const std::size_t x, const std::size_t y) const {
             return Get(x, y);
         }
@@ -185,7 +202,7 @@ namespace SDL {
             if (x >= 4)
                 throw std::out_of_range("x (which is " + std::to_string(x) + ") >= width (which is 4)");
             if (y >= 4)
-                throw std::out_of_range("y (which is " + std::to_string(x) + ") >= height (which is 4)");
+                throw std::out_of_range("y (which is " + std::to_string(y) + ") >= height (which is 4)");
             return _data[x + y * 4];
         }
 
@@ -193,10 +210,26 @@ namespace SDL {
             if (x >= 4)
                 throw std::out_of_range("x (which is " + std::to_string(x) + ") >= width (which is 4)");
             if (y >= 4)
-                throw std::out_of_range("y (which is " + std::to_string(x) + ") >= height (which is 4)");
+                throw std::out_of_range("y (which is " + std::to_string(y) + ") >= height (which is 4)");
             return _data[x + y * 4];
         }
 
+        [[nodiscard]] constexpr const T &At(const std::size_t x, const std::size_t y) const noexcept {
+            return _data[x + y * 4];
+        }
+
+        [[nodiscard]] constexpr T &At(const std::size_t x, const std::size_t y) noexcept {
+            return _data[x + y * 4];
+        }
+
+        [[nodiscard]] constexpr const T &operator[](const std::size_t i) const noexcept {
+            return _data[i];
+        }
+
+        [[nodiscard]] constexpr T &operator[](const std::size_t i) noexcept {
+            return _data[i];
+        }
+
         [[nodiscard]] constexpr const T &operator()(const std::size_t x, const std::size_t y) const {
             return Get(x, y);
         }
@@ -307,7 +340,7 @@ namespace SDL {
 
     template <typename T>
     constexpr Vector3<T> Apply(const Matrix4x4<T> &mat4, const Vector3<T> &vec3) {
-        return static_cast<Vector3<T>>(mat4 * Matrix4x3<T>(vec3));
+        return static_cast<Vector3<T>>(mat4 * Matrix4x4<T>(vec3));
     }
 
     template <typename T>
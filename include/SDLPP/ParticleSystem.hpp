@@ -0,0 +1,50 @@
+#ifndef PARTICLESYSTEM_HPP
+#define PARTICLESYSTEM_HPP
+#include <cstddef>
+#include <vector>
+
+#include "Color.hpp"
+#include "Drawable.hpp"
+#include "Texture.hpp"
+#include "Vector.hpp"
+#include "VertexStreams.hpp"
+
+namespace SDL {
+    class ParticleSystem : public Drawable {
+    public:
+        explicit ParticleSystem(std::size_t capacity);
+
+        bool Emit(const FVector2 &position, const FVector2 &velocity, float life, const FColor &color);
+        void Update(float dt);
+        void Clear();
+
+        void SetGravity(const FVector2 &gravity);
+        [[nodiscard]] const FVector2 &GetGravity() const;
+
+        void SetSize(float size);
+        [[nodiscard]] float GetSize() const;
+
+        void SetTexture(const Texture &texture);
+        void SetTexture(std::nullptr_t);
+
+        [[nodiscard]] std::size_t Count() const;
+        [[nodiscard]] std::size_t Capacity() const;
+
+        void Draw(Renderer &renderer) const override;
+    private:
+        void Kill(std::size_t i);
+        void WriteQuads(std::size_t first, std::size_t count);
+
+        std::size_t _capacity;
+        std::size_t _count = 0;
+        std::vector<float> _x, _y;
+        std::vector<float> _vx, _vy;
+        std::vector<float> _life;
+        VertexStreams _streams;
+        FVector2 _gravity;
+        float _size = 1;
+        Texture _texture;
+    };
+}
+
+#endif //PARTICLESYSTEM_HPP
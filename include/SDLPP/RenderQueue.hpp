@@ -0,0 +1,60 @@
+#ifndef RENDERQUEUE_HPP
+#define RENDERQUEUE_HPP
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <SDL3/SDL_render.h>
+
+#include "Rect.hpp"
+
+namespace SDL {
+    class RenderQueue {
+    public:
+        struct Command {
+            int layer;
+            std::size_t clipRect;
+            SDL_Texture *texture;
+            std::size_t textureId;
+            SDL_BlendMode blendMode;
+            std::size_t vertexOffset;
+            int vertexCount;
+            std::size_t indexOffset;
+            int indexCount;
+        };
+
+        RenderQueue();
+
+        void Add(const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount, SDL_Texture *texture, SDL_BlendMode blendMode, int layer, const std::optional<Rect<>> &clipRect);
+        // Commands keep their submission order within a layer unless the layer is marked unordered, in which
+        // case they are grouped by clip rect, texture (in order of first use) and blend mode.
+        void SetUnordered(int layer, bool unordered);
+        [[nodiscard]] bool IsUnordered(int layer) const;
+        void Sort();
+        void Clear();
+
+        [[nodiscard]] bool Empty() const;
+        [[nodiscard]] std::size_t CommandCount() const;
+        [[nodiscard]] const std::vector<Command> &GetCommands() const;
+        [[nodiscard]] const std::optional<Rect<>> &GetClipRect(const Command &command) const;
+        [[nodiscard]] const SDL_Vertex *GetVertices(const Command &command) const;
+        [[nodiscard]] const int *GetIndices(const Command &command) const;
+
+        [[nodiscard]] std::size_t GetStateChangesBeforeSort() const;
+        [[nodiscard]] std::size_t GetStateChangesAfterSort() const;
+    private:
+        [[nodiscard]] std::size_t CountStateChanges() const;
+
+        std::vector<SDL_Vertex> _vertices;
+        std::vector<int> _indices;
+        std::vector<Command> _commands;
+        std::vector<std::optional<Rect<>>> _clipRects;
+        std::unordered_map<SDL_Texture *, std::size_t> _textureIds;
+        std::vector<int> _unorderedLayers;
+
+        std::size_t _changesBefore = 0;
+        std::size_t _changesAfter = 0;
+    };
+}
+
+#endif //RENDERQUEUE_HPP
@@ -0,0 +1,61 @@
+#ifndef RENDERTARGETPOOL_HPP
+#define RENDERTARGETPOOL_HPP
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <SDL3/SDL_render.h>
+
+#include "Texture.hpp"
+#include "Vector.hpp"
+
+namespace SDL {
+    class Renderer;
+
+    class RenderTargetPool {
+    public:
+        struct Stats {
+            std::size_t hits = 0;
+            std::size_t misses = 0;
+            std::size_t evictions = 0;
+        };
+
+        explicit RenderTargetPool(const Renderer &renderer, unsigned int maxIdleFrames = 3);
+
+        [[nodiscard]] Texture &Acquire(const UVector2 &size, SDL_PixelFormat format = SDL_PIXELFORMAT_RGBA8888, SDL_TextureAccess access = SDL_TEXTUREACCESS_TARGET);
+        void Release(const Texture &texture);
+        void EndFrame();
+        void Clear();
+
+        [[nodiscard]] std::size_t GetPooledCount() const;
+        [[nodiscard]] std::size_t GetLeasedCount() const;
+        [[nodiscard]] const Stats &GetStats() const;
+        void ResetStats();
+    private:
+        struct Key {
+            UVector2 size;
+            SDL_PixelFormat format;
+            SDL_TextureAccess access;
+
+            bool operator==(const Key &other) const;
+        };
+
+        struct KeyHash {
+            std::size_t operator()(const Key &key) const;
+        };
+
+        struct Entry {
+            Texture texture;
+            bool leased = false;
+            std::size_t lastUsed = 0;
+        };
+
+        const Renderer &_renderer;
+        unsigned int _maxIdleFrames;
+        std::unordered_map<Key, std::vector<std::unique_ptr<Entry>>, KeyHash> _buckets;
+        std::size_t _frame = 0;
+        Stats _stats;
+    };
+}
+
+#endif //RENDERTARGETPOOL_HPP
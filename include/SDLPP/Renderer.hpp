@@ -1,19 +1,32 @@
 ﻿#ifndef RENDERER_HPP
 #define RENDERER_HPP
 #include <memory>
+#include <span>
+#include <utility>
+#include <vector>
 #include "Window.hpp"
 
 #include "Color.hpp"
+#include "CommandList.hpp"
 #include "Drawable.hpp"
+#include "FrameArena.hpp"
 #include "Properties.hpp"
 #include "Rect.hpp"
+#include "RenderQueue.hpp"
+#include "SpriteBatch.hpp"
 #include "Texture.hpp"
 #include "Vertex.hpp"
+#include "VertexStreams.hpp"
 #include "APIObject.hpp"
 
 namespace SDL {
     class Renderer {
     public:
+        struct StateStats {
+            std::size_t applied = 0;
+            std::size_t skipped = 0;
+        };
+
         Renderer(Renderer &&renderer) noexcept;
         Renderer &operator=(Renderer &&renderer) noexcept;
 
@@ -33,17 +46,46 @@ namespace SDL {
 
         [[nodiscard]] SDL_Renderer *Get() const;
         operator SDL_Renderer *() const;
+        // Flushes pending geometry and forgets cached state; call before drawing or changing state through SDL directly.
+        [[nodiscard]] SDL_Renderer *Raw();
 
         void SetDrawColor(const Color &color);
         [[nodiscard]] Color GetDrawColor() const;
 
+        void SetDrawBlendMode(SDL_BlendMode blendMode);
+        [[nodiscard]] SDL_BlendMode GetDrawBlendMode() const;
+
         void Clear();
         void Clear(const Color &color);
 
         void Draw(const SDL_Vertex *vertices, int vertexCount, const Texture &texture = nullptr);
         void Draw(const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount, const Texture &texture = nullptr);
+        void Draw(std::span<const Vertex> vertices, const Texture &texture = nullptr);
+        void Draw(std::span<const Vertex> vertices, std::span<const int> indices, const Texture &texture = nullptr);
         void Draw(const VertexBuffer &vertices, const Texture &texture = nullptr);
+        void Draw(const VertexStreams &streams, const Texture &texture = nullptr);
+        void Draw(const float *positions, int positionStride, const SDL_FColor *colors, int colorStride, const float *texCoords,
+            int texCoordStride, int vertexCount, const void *indices, int indexCount, int indexSize, const Texture &texture = nullptr);
         void Draw(const Drawable &drawable);
+        void Draw(const CommandList &list);
+        void Draw(std::span<const CommandList> lists);
+
+        void SetBatching(bool enable);
+        [[nodiscard]] bool IsBatching() const;
+        void Flush();
+        [[nodiscard]] const SpriteBatch &GetBatch() const;
+        void ResetBatchStats();
+
+        // Deferred draws keep raw texture pointers until Flush() or Display(); textures they use, including ones
+        // held by a TextureCache or RenderTargetPool, must stay alive until then.
+        void SetDeferred(bool enable);
+        [[nodiscard]] bool IsDeferred() const;
+        void SetLayer(int layer);
+        [[nodiscard]] int GetLayer() const;
+        // Lets the queue group this layer's draws by texture; the textures must still outlive the frame.
+        void SetLayerUnordered(int layer, bool unordered);
+        [[nodiscard]] bool IsLayerUnordered(int layer) const;
+        [[nodiscard]] const RenderQueue &GetQueue() const;
 
         void SetViewport(const std::optional<Rect<>> &rect);
         [[nodiscard]] Rect<> GetViewport() const;
@@ -55,10 +97,44 @@ namespace SDL {
         [[nodiscard]] bool GetVSync() const;
 
         void Display();
+        // Display() reclaims everything allocated from the arena; buffers built on it must not outlive the frame.
+        [[nodiscard]] FrameArena &GetFrameArena();
 
         [[nodiscard]] Properties GetProperties() const;
+
+        void InvalidateState() const;
+        [[nodiscard]] const StateStats &GetStateStats() const;
+        void ResetStateStats();
     private:
+        struct State {
+            std::optional<Color> drawColor;
+            std::optional<SDL_BlendMode> drawBlendMode;
+            std::optional<SDL_Texture *> target;
+            std::optional<std::optional<Rect<>>> viewport;
+            std::optional<std::optional<Rect<>>> clipRect;
+        };
+
+        void ApplyDrawColor(const Color &color) const;
+        void ApplyDrawBlendMode(SDL_BlendMode blendMode);
+        void ApplyClipRect(const std::optional<Rect<>> &rect);
+        void ApplyTextureBlendMode(SDL_Texture *texture, SDL_BlendMode blendMode);
+
+        void DrawGeometry(const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount, SDL_Texture *texture);
+        void Submit(const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount, SDL_Texture *texture);
+        void SubmitQueue();
+
         Object::APIObject<SDL_Renderer *> _renderer;
+        SpriteBatch _batch;
+        bool _batching = false;
+        RenderQueue _queue;
+        std::vector<std::pair<SDL_Texture *, SDL_BlendMode>> _textureBlendModes;
+        bool _deferred = false;
+        int _layer = 0;
+        std::optional<Rect<>> _clipRect;
+        mutable std::optional<Color> _drawColor;
+        mutable State _state;
+        mutable StateStats _stateStats;
+        std::unique_ptr<FrameArena> _frameArena = std::make_unique<FrameArena>();
     };
 }
 
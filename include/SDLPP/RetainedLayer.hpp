@@ -0,0 +1,56 @@
+#ifndef RETAINEDLAYER_HPP
+#define RETAINEDLAYER_HPP
+#include <cstddef>
+#include <vector>
+
+#include "Color.hpp"
+#include "Drawable.hpp"
+#include "Rect.hpp"
+#include "Shape.hpp"
+#include "Texture.hpp"
+#include "Vector.hpp"
+
+namespace SDL {
+    class RetainedLayer : public Drawable {
+    public:
+        RetainedLayer(const Renderer &renderer, const UVector2 &size, std::size_t maxRects = 8);
+
+        void Add(const Shape &shape);
+        void Add(const Drawable &drawable, const FRect &bounds);
+        void Remove(const Drawable &drawable);
+
+        void Invalidate(const Drawable &drawable, const FRect &bounds);
+        void Invalidate(const FRect &rect);
+        void InvalidateAll();
+
+        void SetBackground(const Color &color);
+        [[nodiscard]] const Color &GetBackground() const;
+
+        [[nodiscard]] const Texture &GetTexture() const;
+        [[nodiscard]] const std::vector<Rect<>> &GetDirtyRects() const;
+
+        void Draw(Renderer &renderer) const override;
+    private:
+        struct Item {
+            const Drawable *drawable;
+            const Shape *shape;
+            FRect bounds;
+            std::size_t revision;
+        };
+
+        void Collect() const;
+        void Merge() const;
+        void Redraw(Renderer &renderer) const;
+        void AddDirty(const FRect &rect) const;
+
+        UVector2 _size;
+        std::size_t _maxRects;
+        Texture _texture;
+        Color _background = Color::Black;
+        mutable std::vector<Item> _items;
+        mutable std::vector<Rect<>> _dirty;
+        mutable std::vector<Rect<>> _redrawn;
+    };
+}
+
+#endif //RETAINEDLAYER_HPP
@@ -4,25 +4,41 @@
 #include "Angle.hpp"
 #include "APIObject.hpp"
 #include "Color.hpp"
+#include "CommandList.hpp"
 #include "Drawable.hpp"
 #include "Error.hpp"
 #include "Event.hpp"
+#include "Font.hpp"
+#include "FrameArena.hpp"
 #include "FramerateLimiter.hpp"
 #include "Init.hpp"
 #include "Math.hpp"
 #include "Matrix.hpp"
+#include "ParticleSystem.hpp"
 #include "Properties.hpp"
 #include "Rect.hpp"
 #include "Renderer.hpp"
+#include "RenderQueue.hpp"
+#include "RenderTargetPool.hpp"
+#include "RetainedLayer.hpp"
 #include "Shape.hpp"
 #include "Shapes.hpp"
+#include "SpriteBatch.hpp"
+#include "StreamingTexture.hpp"
 #include "Surface.hpp"
+#include "Text.hpp"
 #include "Texture.hpp"
+#include "TextureAtlas.hpp"
+#include "TextureCache.hpp"
+#include "TextureLoader.hpp"
+#include "ThreadPool.hpp"
+#include "TileMap.hpp"
 #include "Timer.hpp"
 #include "Transform.hpp"
 #include "Transformable.hpp"
 #include "Vector.hpp"
 #include "Vertex.hpp"
+#include "VertexStreams.hpp"
 #include "Window.hpp"
 
 #endif //SDLPP_HPP
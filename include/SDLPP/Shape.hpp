@@ -1,11 +1,17 @@
 #ifndef SHAPE_HPP
 #define SHAPE_HPP
 
+#include <memory>
+#include <span>
+#include <vector>
+
 #include "Drawable.hpp"
 #include "Rect.hpp"
 #include "Vertex.hpp"
 
 namespace SDL {
+    class CommandList;
+
     class Shape : public Drawable {
     public:
         Shape();
@@ -16,17 +22,46 @@ namespace SDL {
         [[nodiscard]] virtual FVector2 GetPoint(std::size_t i) const= 0;
         [[nodiscard]] virtual std::size_t GetPointCount() const= 0;
         [[nodiscard]] FRect GetBoundingBox() const;
+        [[nodiscard]] std::size_t GetRevision() const;
         [[nodiscard]] virtual FVector2 GetCenter() const= 0;
 
+        void Record(CommandList &list) const;
+
+        [[nodiscard]] static std::shared_ptr<const std::vector<int>> GetFanIndices(std::size_t points);
+
     protected:
+        enum DirtyFlags : unsigned char {
+            DirtyNone = 0,
+            DirtyGeometry = 1 << 0,
+            DirtyTransform = 1 << 1,
+            DirtyTranslation = 1 << 2,
+            DirtyColor = 1 << 3
+        };
+
         virtual void Transform(FVector2 &v) const;
-        void Recompute();
+        virtual void Transform(std::span<FVector2> points) const;
+
+        void InvalidateGeometry();
+        void InvalidateTransform();
+        void InvalidateTranslation(const FVector2 &delta);
+        void Update() const;
 
         void Draw(Renderer &renderer) const override;
     private:
+        void RecomputeOutline() const;
+        void Recompute() const;
+        void RecomputeTranslation() const;
+        void RecomputeColor() const;
+
         Color _color;
-        VertexBuffer _vertices;
-        FRect _bounds;
+        mutable std::vector<FVector2> _outline;
+        mutable FVector2 _center;
+        mutable VertexBuffer _vertices;
+        mutable std::shared_ptr<const std::vector<int>> _indices;
+        mutable FRect _bounds;
+        mutable FVector2 _translation;
+        mutable unsigned char _dirty = DirtyGeometry;
+        std::size_t _revision = 0;
     };
 }
 
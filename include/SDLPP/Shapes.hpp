@@ -2,6 +2,8 @@
 #define SHAPES_HPP
 
 #include <complex>
+#include <memory>
+#include <vector>
 
 #include "Renderer.hpp"
 #include "Transformable.hpp"
@@ -31,6 +33,8 @@ namespace SDL::Shapes {
         [[nodiscard]] float GetRadius() const;
         void SetPoints(unsigned int points);
         [[nodiscard]] unsigned int GetPoints() const;
+
+        [[nodiscard]] static std::shared_ptr<const std::vector<FVector2>> GetUnitCircle(unsigned int points);
     private:
         [[nodiscard]] FVector2 GetCenter() const override;
         [[nodiscard]] FVector2 GetPoint(std::size_t i) const override;
@@ -38,6 +42,7 @@ namespace SDL::Shapes {
 
         float _radius = 0.0f;
         unsigned int _points = 30;
+        std::shared_ptr<const std::vector<FVector2>> _unitCircle;
     };
 }
 
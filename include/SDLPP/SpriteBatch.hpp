@@ -0,0 +1,35 @@
+#ifndef SPRITEBATCH_HPP
+#define SPRITEBATCH_HPP
+#include <cstddef>
+#include <vector>
+#include <SDL3/SDL_render.h>
+
+namespace SDL {
+    class SpriteBatch {
+    public:
+        SpriteBatch();
+
+        void Add(SDL_Renderer *renderer, const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount, SDL_Texture *texture);
+        void Flush(SDL_Renderer *renderer);
+        void Clear();
+
+        [[nodiscard]] bool Empty() const;
+        [[nodiscard]] std::size_t VertexCount() const;
+        [[nodiscard]] std::size_t IndexCount() const;
+
+        [[nodiscard]] std::size_t GetDrawCount() const;
+        [[nodiscard]] std::size_t GetFlushCount() const;
+        [[nodiscard]] std::size_t GetSavedCalls() const;
+        void ResetStats();
+    private:
+        std::vector<SDL_Vertex> _vertices;
+        std::vector<int> _indices;
+        SDL_Texture *_texture = nullptr;
+        SDL_BlendMode _blendMode = SDL_BLENDMODE_INVALID;
+
+        std::size_t _draws = 0;
+        std::size_t _flushes = 0;
+    };
+}
+
+#endif //SPRITEBATCH_HPP
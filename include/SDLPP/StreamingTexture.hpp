@@ -0,0 +1,35 @@
+#ifndef STREAMINGTEXTURE_HPP
+#define STREAMINGTEXTURE_HPP
+#include <cstddef>
+#include <vector>
+#include <SDL3/SDL_pixels.h>
+
+#include "Texture.hpp"
+#include "Vector.hpp"
+
+namespace SDL {
+    class Renderer;
+
+    class StreamingTexture {
+    public:
+        StreamingTexture(const Renderer &renderer, const UVector2 &size, SDL_PixelFormat format = SDL_PIXELFORMAT_RGBA8888, std::size_t bufferCount = 2);
+
+        [[nodiscard]] Texture::LockedPixels Lock();
+        void Unlock();
+        void Update(const void *pixels, int pitch);
+
+        [[nodiscard]] const Texture &GetTexture() const;
+        [[nodiscard]] std::size_t GetBufferCount() const;
+        [[nodiscard]] const UVector2 &GetSize() const;
+        [[nodiscard]] bool IsLocked() const;
+    private:
+        [[nodiscard]] std::size_t GetBackIndex() const;
+
+        std::vector<Texture> _textures;
+        UVector2 _size;
+        std::size_t _front = 0;
+        bool _locked = false;
+    };
+}
+
+#endif //STREAMINGTEXTURE_HPP
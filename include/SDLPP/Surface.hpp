@@ -1,5 +1,6 @@
 #ifndef SURFACE_HPP
 #define SURFACE_HPP
+#include <string>
 #include <SDL3/SDL_surface.h>
 
 #include "APIObject.hpp"
@@ -10,6 +11,8 @@
 
 
 namespace SDL {
+    class ThreadPool;
+
     class Surface {
     public:
         Surface();
@@ -22,11 +25,15 @@ namespace SDL {
         Surface(SDL_Surface *surface);
         Surface(SDL_Surface *surface, Borrowed borrowed);
 
+        void LoadFile(const std::string &file);
+
         void Clear(const Color &color);
 
         void Blit(const std::optional<Rect<>> &srcRect, Surface &dst, const std::optional<Rect<>> &dstRect);
+        void Blit(const std::optional<Rect<>> &srcRect, Surface &dst, const std::optional<Rect<>> &dstRect, ThreadPool &pool);
         void Blit9Grid(const std::optional<Rect<>> &srcRect, int leftWidth, int rightWidth, int topHeight, int bottomHeight, float scale, SDL_ScaleMode scaleMode, Surface &dst, const std::optional<Rect<>> &dstRect);
         void BlitScaled(const std::optional<Rect<>> &srcRect, Surface &dst, const std::optional<Rect<>> &dstRect, SDL_ScaleMode scaleMode);
+        void BlitScaled(const std::optional<Rect<>> &srcRect, Surface &dst, const std::optional<Rect<>> &dstRect, SDL_ScaleMode scaleMode, ThreadPool &pool);
         void BlitTiled(const std::optional<Rect<>> &srcRect, Surface &dst, const std::optional<Rect<>> &dstRect);
         void BlitUnchecked(Rect<> srcRect, Surface &dst, Rect<> dstRect);
         void BlitUncheckedScaled(Rect<> srcRect, Surface &dst, Rect<> dstRect, SDL_ScaleMode scaleMode);
@@ -36,8 +43,8 @@ namespace SDL {
 
         [[nodiscard]] Vector2<> GetSize() const;
 
-        Surface Convert(SDL_PixelFormat format);
-        Surface Duplicate();
+        Surface Convert(SDL_PixelFormat format) const;
+        Surface Duplicate() const;
 
         std::vector<Surface> GetImages() const;
 
@@ -59,6 +66,7 @@ namespace SDL {
 
         void SetAlphaMod(Uint8 alphaMod);
         [[nodiscard]] Uint8 GetAlphaMod() const;
+        void BakeAlphaMod();
 
         void SetBlendMode(SDL_BlendMode blendMode);
         [[nodiscard]] SDL_BlendMode GetBlendMode() const;
@@ -72,6 +80,7 @@ namespace SDL {
 
         void SetColorMod(Color color);
         [[nodiscard]] Color GetColorMod() const;
+        void BakeColorMod();
 
         void SetColorspace(SDL_Colorspace colorspace);
         [[nodiscard]] SDL_Colorspace GetColorspace() const;
@@ -88,8 +97,10 @@ namespace SDL {
         [[nodiscard]] Uint32 MapRGBA(Color color) const;
 
         void PremultiplyAlpha(bool linear);
+        void UnpremultiplyAlpha();
 
         void Stretch(Rect<> srcRect, Surface &dst, Rect<> dstRect, SDL_ScaleMode scaleMode);
+        void Stretch(Rect<> srcRect, Surface &dst, Rect<> dstRect, SDL_ScaleMode scaleMode, ThreadPool &pool);
 
         void WritePixel(Vector2<> position, Color color);
         void WritePixelFloat(Vector2<> position, FColor color);
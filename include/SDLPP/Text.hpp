@@ -0,0 +1,52 @@
+#ifndef TEXT_HPP
+#define TEXT_HPP
+#include <string>
+#include <vector>
+
+#include "Color.hpp"
+#include "Drawable.hpp"
+#include "Font.hpp"
+#include "Rect.hpp"
+#include "Vector.hpp"
+#include "Vertex.hpp"
+
+namespace SDL {
+    class Text : public Drawable {
+    public:
+        Text();
+        Text(const Font &font, const std::string &string);
+
+        void SetFont(const Font &font);
+        [[nodiscard]] const Font *GetFont() const;
+
+        void SetString(const std::string &string);
+        [[nodiscard]] const std::string &GetString() const;
+
+        void SetColor(const Color &color);
+        [[nodiscard]] const Color &GetColor() const;
+
+        void SetPosition(const FVector2 &position);
+        [[nodiscard]] const FVector2 &GetPosition() const;
+
+        [[nodiscard]] FRect GetBounds() const;
+
+        void Draw(Renderer &renderer) const override;
+    private:
+        void Update() const;
+        void Layout() const;
+
+        const Font *_font = nullptr;
+        std::string _string;
+        Color _color = Color::White;
+        FVector2 _position;
+
+        mutable std::vector<VertexBuffer> _pages;
+        mutable std::vector<std::vector<FVector2>> _offsets;
+        mutable FRect _bounds;
+        mutable FVector2 _origin;
+        mutable bool _layoutDirty = true;
+        mutable bool _colorDirty = false;
+    };
+}
+
+#endif //TEXT_HPP
@@ -2,6 +2,8 @@
 #define TEXTURE_HPP
 #include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <SDL3/SDL_render.h>
 
@@ -14,6 +16,15 @@ namespace SDL {
 
     class Texture {
     public:
+        struct LockedPixels {
+            std::span<std::byte> pixels;
+            int pitch;
+            Vector2<> size;
+            SDL_PixelFormat format;
+
+            [[nodiscard]] std::span<std::byte> Row(int y) const;
+        };
+
         Texture();
         Texture(Texture &&texture) noexcept;
         Texture &operator=(Texture &&texture) noexcept;
@@ -29,6 +40,7 @@ namespace SDL {
 
         void Update(Rect<> rect, const void *pixels, int pitch);
         void Lock(Rect<> rect, void **pixels, int &pitch);
+        [[nodiscard]] LockedPixels Lock(const std::optional<Rect<>> &rect = std::nullopt);
         void Unlock();
 
         explicit operator bool() const;
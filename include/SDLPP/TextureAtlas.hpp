@@ -0,0 +1,56 @@
+#ifndef TEXTUREATLAS_HPP
+#define TEXTUREATLAS_HPP
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include "Rect.hpp"
+#include "Surface.hpp"
+#include "Texture.hpp"
+#include "Vector.hpp"
+
+namespace SDL {
+    class Renderer;
+
+    class TextureAtlas {
+    public:
+        struct Region {
+            std::size_t page;
+            Rect<> rect;
+            FRect uv;
+
+            [[nodiscard]] FVector2 TexCoord(const FVector2 &coord) const;
+        };
+
+        explicit TextureAtlas(const Renderer &renderer, const UVector2 &pageSize = {2048, 2048}, unsigned int padding = 1, SDL_PixelFormat format = SDL_PIXELFORMAT_RGBA32);
+
+        Region Add(const Surface &surface);
+        void Clear();
+
+        [[nodiscard]] std::size_t PageCount() const;
+        [[nodiscard]] const Texture &GetTexture(std::size_t page) const;
+        [[nodiscard]] const Texture &GetTexture(const Region &region) const;
+        [[nodiscard]] const UVector2 &GetPageSize() const;
+    private:
+        struct SkylineNode {
+            int x, y, width;
+        };
+
+        struct Page {
+            Texture texture;
+            std::vector<SkylineNode> skyline;
+        };
+
+        Page &AddPage();
+        [[nodiscard]] std::optional<Rect<>> Pack(Page &page, const Vector2<> &size) const;
+
+        const Renderer &_renderer;
+        UVector2 _pageSize;
+        unsigned int _padding;
+        SDL_PixelFormat _format;
+        std::deque<Page> _pages;
+    };
+}
+
+#endif //TEXTUREATLAS_HPP
@@ -0,0 +1,55 @@
+#ifndef TEXTURECACHE_HPP
+#define TEXTURECACHE_HPP
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <SDL3/SDL_render.h>
+
+#include "Texture.hpp"
+
+namespace SDL {
+    class Renderer;
+
+    class TextureCache {
+    public:
+        struct Stats {
+            std::size_t hits = 0;
+            std::size_t misses = 0;
+            std::size_t evictions = 0;
+        };
+
+        explicit TextureCache(const Renderer &renderer, std::size_t budget = 256 * 1024 * 1024);
+
+        [[nodiscard]] std::shared_ptr<const Texture> Load(const std::string &path, SDL_ScaleMode scaleMode = SDL_SCALEMODE_LINEAR);
+        void Trim();
+        void Clear();
+
+        void SetBudget(std::size_t bytes);
+        [[nodiscard]] std::size_t GetBudget() const;
+
+        [[nodiscard]] std::size_t GetCount() const;
+        [[nodiscard]] std::size_t GetResidentBytes() const;
+        [[nodiscard]] double GetHitRate() const;
+        [[nodiscard]] const Stats &GetStats() const;
+        void ResetStats();
+
+        [[nodiscard]] static std::size_t EstimateBytes(const Texture &texture);
+    private:
+        struct Entry {
+            std::string key;
+            std::shared_ptr<const Texture> texture;
+            std::size_t bytes;
+        };
+
+        const Renderer &_renderer;
+        std::size_t _budget;
+        std::list<Entry> _entries;
+        std::unordered_map<std::string, std::list<Entry>::iterator> _lookup;
+        std::size_t _residentBytes = 0;
+        Stats _stats;
+    };
+}
+
+#endif //TEXTURECACHE_HPP
@@ -0,0 +1,82 @@
+#ifndef TEXTURELOADER_HPP
+#define TEXTURELOADER_HPP
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "Surface.hpp"
+#include "Texture.hpp"
+#include "ThreadPool.hpp"
+
+namespace SDL {
+    class Renderer;
+
+    class TextureLoader {
+        struct Request;
+    public:
+        class Handle {
+        public:
+            Handle();
+
+            [[nodiscard]] bool IsValid() const;
+            [[nodiscard]] bool IsReady() const;
+            [[nodiscard]] bool HasFailed() const;
+            [[nodiscard]] const std::string &GetPath() const;
+            [[nodiscard]] std::string GetError() const;
+            [[nodiscard]] Texture &Get() const;
+        private:
+            friend class TextureLoader;
+
+            explicit Handle(std::shared_ptr<Request> request);
+
+            std::shared_ptr<Request> _request;
+        };
+
+        // uploadBudget is in bytes per Update(); any non-zero budget uploads at least one row per frame, 0 pauses uploads.
+        TextureLoader(const Renderer &renderer, ThreadPool &pool, std::size_t uploadBudget = 4 * 1024 * 1024);
+
+        Handle LoadAsync(const std::string &path);
+        void Update();
+
+        void SetUploadBudget(std::size_t bytes);
+        [[nodiscard]] std::size_t GetUploadBudget() const;
+        [[nodiscard]] std::size_t GetPendingCount() const;
+        [[nodiscard]] std::size_t GetUploadedBytes() const;
+    private:
+        enum State {
+            Decoding,
+            Uploading,
+            Ready,
+            Failed
+        };
+
+        struct Request {
+            std::string path;
+            std::atomic<State> state = Decoding;
+            Surface surface;
+            Texture texture;
+            int uploadedRows = 0;
+            std::string error;
+        };
+
+        struct Queue {
+            std::mutex mutex;
+            std::deque<std::shared_ptr<Request>> decoded;
+        };
+
+        bool Upload(Request &request, std::size_t &uploaded);
+
+        const Renderer &_renderer;
+        ThreadPool &_pool;
+        std::size_t _uploadBudget;
+        std::shared_ptr<Queue> _queue = std::make_shared<Queue>();
+        std::deque<std::shared_ptr<Request>> _uploading;
+        std::size_t _pending = 0;
+        std::size_t _uploadedBytes = 0;
+    };
+}
+
+#endif //TEXTURELOADER_HPP
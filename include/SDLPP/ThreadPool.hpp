@@ -0,0 +1,39 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SDL {
+    class ThreadPool {
+    public:
+        explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency());
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+        ~ThreadPool();
+
+        void Submit(std::function<void()> task);
+        void Wait();
+        // Runs body(index, slot) for every index below count on the caller and idle workers; slot is
+        // 0 on the caller and at most GetThreadCount() on a worker, and no two concurrent calls share a slot.
+        void ParallelFor(std::size_t count, const std::function<void(std::size_t, std::size_t)> &body);
+
+        [[nodiscard]] std::size_t GetThreadCount() const;
+    private:
+        void Work();
+
+        std::vector<std::thread> _threads;
+        std::deque<std::function<void()>> _tasks;
+        std::mutex _mutex;
+        std::condition_variable _taskAvailable;
+        std::condition_variable _idle;
+        std::size_t _active = 0;
+        bool _stopping = false;
+    };
+}
+
+#endif //THREADPOOL_HPP
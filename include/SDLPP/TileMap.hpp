@@ -0,0 +1,59 @@
+#ifndef TILEMAP_HPP
+#define TILEMAP_HPP
+#include <cstddef>
+#include <vector>
+
+#include "Drawable.hpp"
+#include "Rect.hpp"
+#include "Texture.hpp"
+#include "Vector.hpp"
+#include "Vertex.hpp"
+
+namespace SDL {
+    class TileMap : public Drawable {
+    public:
+        static constexpr int Empty = -1;
+
+        TileMap(const UVector2 &size, const UVector2 &tileSize, unsigned int chunkSize = 32);
+
+        void SetTileset(const Texture &tileset);
+        void SetTile(const UVector2 &position, int tile);
+        [[nodiscard]] int GetTile(const UVector2 &position) const;
+        void Fill(int tile);
+
+        void SetPosition(const FVector2 &position);
+        [[nodiscard]] const FVector2 &GetPosition() const;
+
+        [[nodiscard]] const UVector2 &GetSize() const;
+        [[nodiscard]] const UVector2 &GetTileSize() const;
+        [[nodiscard]] std::size_t GetChunkCount() const;
+        [[nodiscard]] std::size_t GetDrawnChunkCount() const;
+        [[nodiscard]] std::size_t GetRebuildCount() const;
+
+        void Draw(Renderer &renderer) const override;
+    private:
+        struct Chunk {
+            VertexBuffer vertices;
+            std::vector<FVector2> offsets;
+            FVector2 origin;
+            bool dirty = true;
+        };
+
+        [[nodiscard]] std::size_t GetChunkIndex(const UVector2 &position) const;
+        [[nodiscard]] FRect GetChunkBounds(std::size_t chunk) const;
+        void Rebuild(std::size_t chunk) const;
+        void Translate(Chunk &chunk) const;
+
+        UVector2 _size, _tileSize;
+        unsigned int _chunkSize;
+        UVector2 _chunks;
+        std::vector<int> _tiles;
+        FVector2 _position;
+        Texture _tileset;
+        mutable std::vector<Chunk> _chunkData;
+        mutable std::size_t _drawn = 0;
+        mutable std::size_t _rebuilds = 0;
+    };
+}
+
+#endif //TILEMAP_HPP
@@ -1,5 +1,6 @@
 #ifndef TRANSFORM_HPP
 #define TRANSFORM_HPP
+#include <span>
 
 #include "Angle.hpp"
 #include "Matrix.hpp"
@@ -8,6 +9,7 @@ namespace SDL {
     class Transform {
     public:
         Transform();
+        // Only the top two rows are stored, so matrix must be affine (bottom row 0, 0, 1).
         Transform(const FMatrix3x3 &matrix);
 
         Transform &Translate(const FVector2 &delta);
@@ -20,11 +22,17 @@ namespace SDL {
         [[nodiscard]] FVector2 Apply(const FVector2 &point) const;
         [[nodiscard]] FVector3 Apply(const FVector3 &point) const;
 
+        void ApplyBatch(std::span<FVector2> points) const;
+        void ApplyBatch(std::span<const FVector2> points, std::span<FVector2> result) const;
+
         [[nodiscard]] Transform Inverse() const;
 
-        [[nodiscard]] const FMatrix3x3 &GetMatrix() const;
+        // Expands the stored rows into a new matrix, hence the return by value.
+        [[nodiscard]] FMatrix3x3 GetMatrix() const;
+        [[nodiscard]] const float *Data() const;
     private:
-        FMatrix3x3 _transform = FMatrix3x3::Identity;
+        float _matrix[6] = {1, 0, 0,
+                            0, 1, 0};
     };
 }
 
@@ -21,13 +21,15 @@ namespace SDL {
         [[nodiscard]] const SDL::Transform &GetTransform() const;
 
     protected:
-        void RecomputeTransform();
+        void RecomputeTransform() const;
 
         void Transform(FVector2 &v) const override;
+        void Transform(std::span<FVector2> points) const override;
     private:
         FVector2 _position, _scale{1.0f, 1.0f}, _origin;
         Angle _rotation;
-        SDL::Transform _transform;
+        mutable SDL::Transform _transform;
+        mutable bool _transformDirty = false;
     };
 }
 
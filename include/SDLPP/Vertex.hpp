@@ -1,6 +1,9 @@
 ﻿#ifndef VERTEX_HPP
 #define VERTEX_HPP
 #include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
 #include <vector>
 #include <SDL3/SDL_render.h>
 
@@ -20,32 +23,67 @@ namespace SDL {
         FVector2 texCoord;
     };
 
+    static_assert(std::is_standard_layout_v<Vertex> && std::is_trivially_copyable_v<Vertex>);
+    static_assert(sizeof(Vertex) == sizeof(SDL_Vertex));
+    static_assert(offsetof(Vertex, position) == offsetof(SDL_Vertex, position));
+    static_assert(offsetof(Vertex, color) == offsetof(SDL_Vertex, color));
+    static_assert(offsetof(Vertex, texCoord) == offsetof(SDL_Vertex, tex_coord));
+
+    inline const SDL_Vertex *AsSDLVertices(const Vertex *vertices) {
+        return reinterpret_cast<const SDL_Vertex *>(vertices);
+    }
+
+    inline SDL_Vertex *AsSDLVertices(Vertex *vertices) {
+        return reinterpret_cast<SDL_Vertex *>(vertices);
+    }
+
+    void ConvertIndices(const void *indices, int indexSize, std::size_t indexCount, int *out);
+
     class VertexBuffer {
     public:
         VertexBuffer();
+        // The buffer must not outlive resource, nor the frame when resource is the renderer's FrameArena.
+        explicit VertexBuffer(std::pmr::memory_resource *resource);
 
         void Clear();
         void ClearVertices();
         void ClearIndices();
 
         void Add(const Vertex &vertex, bool add_index = false);
+        void Add(std::span<const Vertex> vertices);
         void Add(int index);
         void Add(std::initializer_list<int> indices);
 
+        void Append(std::span<const Vertex> vertices);
+        void Append(std::span<const int> indices, int baseVertex = 0);
+        [[nodiscard]] std::span<Vertex> Map(std::size_t count);
+
+        void Reserve(std::size_t vertexCount, std::size_t indexCount = 0);
         void Resize(std::size_t size);
 
+        void SetIndexSize(int indexSize);
+        [[nodiscard]] int GetIndexSize() const;
+        void Finalize();
+
         [[nodiscard]] SDL_Vertex &GetVertex(std::size_t i);
         [[nodiscard]] const SDL_Vertex &GetVertex(std::size_t i) const;
 
-        [[nodiscard]] const int &GetIndex(std::size_t i) const;
+        [[nodiscard]] int GetIndex(std::size_t i) const;
 
         [[nodiscard]] std::size_t VertexCount() const;
         [[nodiscard]] const SDL_Vertex *Vertices() const;
         [[nodiscard]] std::size_t IndexCount() const;
+        // Only valid while GetIndexSize() is 4; after Finalize() may have narrowed the indices, use IndexData().
         [[nodiscard]] const int *Indices() const;
+        [[nodiscard]] const void *IndexData() const;
     private:
-        std::vector<SDL_Vertex> _vertices;
-        std::vector<int> _indices;
+        static int IndexSizeFor(Uint32 index);
+        void Repack(int indexSize);
+
+        std::pmr::vector<SDL_Vertex> _vertices;
+        std::pmr::vector<unsigned char> _indices;
+        int _indexSize = sizeof(Uint32);
+        Uint32 _maxIndex = 0;
     };
 }
 
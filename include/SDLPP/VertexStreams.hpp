@@ -0,0 +1,59 @@
+#ifndef VERTEXSTREAMS_HPP
+#define VERTEXSTREAMS_HPP
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <vector>
+#include <SDL3/SDL_pixels.h>
+
+#include "Color.hpp"
+#include "Vector.hpp"
+
+namespace SDL {
+    class VertexStreams {
+    public:
+        VertexStreams();
+        explicit VertexStreams(std::size_t vertexCount);
+
+        void Clear();
+        void ClearIndices();
+        void Resize(std::size_t vertexCount);
+
+        [[nodiscard]] std::span<FVector2> GetPositions();
+        [[nodiscard]] std::span<const FVector2> GetPositions() const;
+
+        void SetColor(const FColor &color);
+        [[nodiscard]] std::span<FColor> GetColors();
+        [[nodiscard]] std::span<const FColor> GetColors() const;
+        [[nodiscard]] bool HasVertexColors() const;
+
+        void SetTexCoord(const FVector2 &texCoord);
+        [[nodiscard]] std::span<FVector2> GetTexCoords();
+        [[nodiscard]] std::span<const FVector2> GetTexCoords() const;
+        [[nodiscard]] bool HasVertexTexCoords() const;
+
+        void SetIndices(std::span<const int> indices);
+        void Add(int index);
+        void Add(std::initializer_list<int> indices);
+
+        [[nodiscard]] std::size_t VertexCount() const;
+        [[nodiscard]] std::size_t IndexCount() const;
+        [[nodiscard]] const int *Indices() const;
+
+        [[nodiscard]] const float *PositionData() const;
+        [[nodiscard]] int PositionStride() const;
+        [[nodiscard]] const SDL_FColor *ColorData() const;
+        [[nodiscard]] int ColorStride() const;
+        [[nodiscard]] const float *TexCoordData() const;
+        [[nodiscard]] int TexCoordStride() const;
+    private:
+        std::vector<FVector2> _positions;
+        std::vector<FColor> _colors{FColor(1, 1, 1, 1)};
+        std::vector<FVector2> _texCoords{FVector2()};
+        std::vector<int> _indices;
+        bool _vertexColors = false;
+        bool _vertexTexCoords = false;
+    };
+}
+
+#endif //VERTEXSTREAMS_HPP
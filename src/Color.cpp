@@ -55,6 +55,14 @@ namespace SDL {
         return *this = *this - other;
     }
 
+    bool Color::operator==(const Color &other) const {
+        return r == other.r && g == other.g && b == other.b && a == other.a;
+    }
+
+    bool Color::operator!=(const Color &other) const {
+        return !(*this == other);
+    }
+
     Uint32 Color::AsInt() const {
         return r << 24 | g << 16 | b << 8 | a;
     }
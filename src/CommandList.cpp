@@ -0,0 +1,81 @@
+#include "SDLPP/CommandList.hpp"
+#include "SDLPP/Shape.hpp"
+
+namespace SDL {
+    CommandList::CommandList() = default;
+
+    CommandList::CommandList(std::pmr::memory_resource *resource): _vertices(resource), _indices(resource), _commands(resource) {
+
+    }
+
+    void CommandList::Draw(const SDL_Vertex *vertices, const int vertexCount, const Texture &texture) {
+        Draw(vertices, vertexCount, nullptr, 0, texture);
+    }
+
+    void CommandList::Draw(const SDL_Vertex *vertices, const int vertexCount, const int *indices, const int indexCount,
+        const Texture &texture) {
+        if (vertexCount <= 0)
+            return;
+        SDL_Texture *sdl_texture = texture ? texture.Get() : nullptr;
+        if (_commands.empty() || _commands.back().texture != sdl_texture)
+            _commands.push_back({sdl_texture, _vertices.size(), 0, _indices.size(), 0});
+
+        Command &command = _commands.back();
+        const int base = command.vertexCount;
+        _vertices.insert(_vertices.end(), vertices, vertices + vertexCount);
+        if (indices) {
+            _indices.reserve(_indices.size() + indexCount);
+            for (int i = 0; i < indexCount; ++i)
+                _indices.push_back(indices[i] + base);
+            command.indexCount += indexCount;
+        } else {
+            _indices.reserve(_indices.size() + vertexCount);
+            for (int i = 0; i < vertexCount; ++i)
+                _indices.push_back(base + i);
+            command.indexCount += vertexCount;
+        }
+        command.vertexCount += vertexCount;
+    }
+
+    void CommandList::Draw(const VertexBuffer &vertices, const Texture &texture) {
+        const int indexCount = static_cast<int>(vertices.IndexCount());
+        if (!vertices.IndexData() || vertices.GetIndexSize() == sizeof(int)) {
+            Draw(vertices.Vertices(), static_cast<int>(vertices.VertexCount()), static_cast<const int *>(vertices.IndexData()), indexCount, texture);
+            return;
+        }
+        static thread_local std::vector<int> indices;
+        indices.resize(indexCount);
+        ConvertIndices(vertices.IndexData(), vertices.GetIndexSize(), indexCount, indices.data());
+        Draw(vertices.Vertices(), static_cast<int>(vertices.VertexCount()), indices.data(), indexCount, texture);
+    }
+
+    void CommandList::Draw(const Shape &shape) {
+        shape.Record(*this);
+    }
+
+    void CommandList::Clear() {
+        _vertices.clear();
+        _indices.clear();
+        _commands.clear();
+    }
+
+    bool CommandList::Empty() const {
+        return _commands.empty();
+    }
+
+    std::size_t CommandList::CommandCount() const {
+        return _commands.size();
+    }
+
+    const std::pmr::vector<CommandList::Command> &CommandList::GetCommands() const {
+        return _commands;
+    }
+
+    const SDL_Vertex *CommandList::GetVertices(const Command &command) const {
+        return _vertices.data() + command.vertexOffset;
+    }
+
+    const int *CommandList::GetIndices(const Command &command) const {
+        return _indices.data() + command.indexOffset;
+    }
+}
@@ -0,0 +1,132 @@
+#include "SDLPP/Font.hpp"
+
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "SDLPP/Error.hpp"
+#include "SDLPP/Surface.hpp"
+
+namespace SDL {
+    namespace {
+        using Attributes = std::unordered_map<std::string, std::string>;
+
+        Attributes ParseAttributes(std::istringstream &line) {
+            Attributes attributes;
+            std::string token;
+            while (line >> token) {
+                const std::size_t equals = token.find('=');
+                if (equals == std::string::npos)
+                    continue;
+                std::string value = token.substr(equals + 1);
+                if (!value.empty() && value.front() == '"') {
+                    while (value.size() < 2 || value.back() != '"') {
+                        std::string rest;
+                        if (!(line >> rest))
+                            break;
+                        value += ' ' + rest;
+                    }
+                    value = value.substr(1, value.size() >= 2 ? value.size() - 2 : 0);
+                }
+                attributes[token.substr(0, equals)] = value;
+            }
+            return attributes;
+        }
+
+        int GetInt(const Attributes &attributes, const std::string &key) {
+            const auto it = attributes.find(key);
+            if (it == attributes.end())
+                return 0;
+            const std::string &value = it->second;
+            int result = 0;
+            const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+            if (error != std::errc() || end != value.data() + value.size()) {
+                Error::Throw("SDL::Font::Font", ("Invalid value for " + key + ": " + value).c_str());
+                return 0;
+            }
+            return result;
+        }
+    }
+
+    Font::Font(const Renderer &renderer, const std::string &file, const UVector2 &atlasSize): _atlas(renderer, atlasSize) {
+        std::ifstream stream(file);
+        if (!stream)
+            Error::Throw("SDL::Font::Font", ("Could not open " + file).c_str());
+        const std::size_t slash = file.find_last_of("/\\");
+        const std::string directory = slash == std::string::npos ? "" : file.substr(0, slash + 1);
+
+        std::vector<Surface> pages;
+        std::string text;
+        while (std::getline(stream, text)) {
+            std::istringstream line(text);
+            std::string tag;
+            line >> tag;
+            const Attributes attributes = ParseAttributes(line);
+            if (tag == "common") {
+                _lineHeight = static_cast<float>(GetInt(attributes, "lineHeight"));
+                _base = static_cast<float>(GetInt(attributes, "base"));
+            } else if (tag == "page") {
+                const auto file = attributes.find("file");
+                if (file == attributes.end()) {
+                    Error::Throw("SDL::Font::Font", "Page is missing its file attribute");
+                    continue;
+                }
+                const int pageId = GetInt(attributes, "id");
+                if (pageId < 0) {
+                    Error::Throw("SDL::Font::Font", "Page id must not be negative");
+                    continue;
+                }
+                const auto id = static_cast<std::size_t>(pageId);
+                if (pages.size() <= id)
+                    pages.resize(id + 1);
+                Surface page;
+                page.LoadFile(directory + file->second);
+                pages[id] = page.Convert(SDL_PIXELFORMAT_RGBA32);
+            } else if (tag == "char") {
+                const std::size_t page = GetInt(attributes, "page");
+                if (page >= pages.size() || !pages[page].Get())
+                    Error::Throw("SDL::Font::Font", "Glyph references a missing page");
+                const Rect<> rect(GetInt(attributes, "x"), GetInt(attributes, "y"), GetInt(attributes, "width"), GetInt(attributes, "height"));
+                SDL_Surface *source = pages[page].Get();
+                if (rect.position.x < 0 || rect.position.y < 0 || rect.position.x + rect.size.x > source->w || rect.position.y + rect.size.y > source->h)
+                    Error::Throw("SDL::Font::Font", "Glyph lies outside of its page");
+                auto *pixels = static_cast<unsigned char *>(source->pixels) + rect.position.y * source->pitch + rect.position.x * 4;
+                const Surface glyph(rect.size, SDL_PIXELFORMAT_RGBA32, pixels, source->pitch);
+                _glyphs[static_cast<Uint32>(GetInt(attributes, "id"))] = {
+                    _atlas.Add(glyph),
+                    FVector2(static_cast<float>(GetInt(attributes, "xoffset")), static_cast<float>(GetInt(attributes, "yoffset"))),
+                    static_cast<float>(GetInt(attributes, "xadvance"))
+                };
+            } else if (tag == "kerning") {
+                const auto first = static_cast<Uint64>(GetInt(attributes, "first"));
+                const auto second = static_cast<Uint64>(GetInt(attributes, "second"));
+                _kerning[first << 32 | second] = static_cast<float>(GetInt(attributes, "amount"));
+            }
+        }
+    }
+
+    const Font::Glyph *Font::GetGlyph(const Uint32 codepoint) const {
+        const auto it = _glyphs.find(codepoint);
+        return it == _glyphs.end() ? nullptr : &it->second;
+    }
+
+    float Font::GetKerning(const Uint32 first, const Uint32 second) const {
+        if (_kerning.empty())
+            return 0;
+        const auto it = _kerning.find(static_cast<Uint64>(first) << 32 | second);
+        return it == _kerning.end() ? 0 : it->second;
+    }
+
+    float Font::GetLineHeight() const {
+        return _lineHeight;
+    }
+
+    float Font::GetBase() const {
+        return _base;
+    }
+
+    const TextureAtlas &Font::GetAtlas() const {
+        return _atlas;
+    }
+}
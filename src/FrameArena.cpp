@@ -0,0 +1,63 @@
+#include "SDLPP/FrameArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace SDL {
+    FrameArena::FrameArena(const std::size_t blockSize): _blockSize(blockSize) {
+
+    }
+
+    void FrameArena::Reset() {
+        _block = 0;
+        _offset = 0;
+        _used = 0;
+    }
+
+    void FrameArena::Release() {
+        _blocks.clear();
+        Reset();
+    }
+
+    std::size_t FrameArena::GetUsed() const {
+        return _used;
+    }
+
+    std::size_t FrameArena::GetCapacity() const {
+        std::size_t capacity = 0;
+        for (const Block &block : _blocks)
+            capacity += block.size;
+        return capacity;
+    }
+
+    std::size_t FrameArena::GetBlockCount() const {
+        return _blocks.size();
+    }
+
+    void *FrameArena::do_allocate(const std::size_t bytes, const std::size_t alignment) {
+        for (; _block < _blocks.size(); ++_block, _offset = 0) {
+            const Block &block = _blocks[_block];
+            const auto base = reinterpret_cast<std::uintptr_t>(block.data.get());
+            const std::size_t offset = ((base + _offset + alignment - 1) & ~(alignment - 1)) - base;
+            if (offset + bytes <= block.size) {
+                _used += offset + bytes - _offset;
+                _offset = offset + bytes;
+                return block.data.get() + offset;
+            }
+        }
+
+        const std::size_t size = std::max(_blockSize, bytes + alignment);
+        _blocks.push_back({std::make_unique_for_overwrite<std::byte[]>(size), size});
+        _block = _blocks.size() - 1;
+        _offset = 0;
+        return do_allocate(bytes, alignment);
+    }
+
+    void FrameArena::do_deallocate(void *, std::size_t, std::size_t) {
+
+    }
+
+    bool FrameArena::do_is_equal(const memory_resource &other) const noexcept {
+        return this == &other;
+    }
+}
@@ -0,0 +1,237 @@
+#include "SDLPP/ParticleSystem.hpp"
+
+#include <algorithm>
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_intrin.h>
+
+#include "SDLPP/Renderer.hpp"
+
+namespace SDL {
+    static void IntegrateScalar(float *x, float *y, float *vx, float *vy, float *life, const std::size_t count,
+        const float gx, const float gy, const float dt) {
+        for (std::size_t i = 0; i < count; ++i) {
+            vx[i] += gx * dt;
+            vy[i] += gy * dt;
+            x[i] += vx[i] * dt;
+            y[i] += vy[i] * dt;
+            life[i] -= dt;
+        }
+    }
+
+    static void QuadsScalar(const float *x, const float *y, float *out, const std::size_t count, const float h) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const float x0 = x[i] - h, x1 = x[i] + h;
+            const float y0 = y[i] - h, y1 = y[i] + h;
+            float *q = out + i * 8;
+            q[0] = x0; q[1] = y0;
+            q[2] = x1; q[3] = y0;
+            q[4] = x1; q[5] = y1;
+            q[6] = x0; q[7] = y1;
+        }
+    }
+
+#if defined(SDL_SSE_INTRINSICS)
+    SDL_TARGETING("sse") static void IntegrateSSE(float *x, float *y, float *vx, float *vy, float *life, const std::size_t count,
+        const float gx, const float gy, const float dt) {
+        const __m128 gdx = _mm_set1_ps(gx * dt);
+        const __m128 gdy = _mm_set1_ps(gy * dt);
+        const __m128 d = _mm_set1_ps(dt);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const __m128 nvx = _mm_add_ps(_mm_loadu_ps(vx + i), gdx);
+            const __m128 nvy = _mm_add_ps(_mm_loadu_ps(vy + i), gdy);
+            _mm_storeu_ps(vx + i, nvx);
+            _mm_storeu_ps(vy + i, nvy);
+            _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(nvx, d)));
+            _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(nvy, d)));
+            _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), d));
+        }
+        IntegrateScalar(x + i, y + i, vx + i, vy + i, life + i, count - i, gx, gy, dt);
+    }
+
+    SDL_TARGETING("sse") static void QuadsSSE(const float *x, const float *y, float *out, const std::size_t count, const float h) {
+        const __m128 hs = _mm_set1_ps(h);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const __m128 px = _mm_loadu_ps(x + i);
+            const __m128 py = _mm_loadu_ps(y + i);
+            const __m128 x0 = _mm_sub_ps(px, hs), x1 = _mm_add_ps(px, hs);
+            const __m128 y0 = _mm_sub_ps(py, hs), y1 = _mm_add_ps(py, hs);
+            float *q = out + i * 8;
+            __m128 a = _mm_unpacklo_ps(x0, y0), b = _mm_unpacklo_ps(x1, y0);
+            __m128 c = _mm_unpacklo_ps(x1, y1), d = _mm_unpacklo_ps(x0, y1);
+            _mm_storeu_ps(q, _mm_movelh_ps(a, b));
+            _mm_storeu_ps(q + 4, _mm_movelh_ps(c, d));
+            _mm_storeu_ps(q + 8, _mm_movehl_ps(b, a));
+            _mm_storeu_ps(q + 12, _mm_movehl_ps(d, c));
+            a = _mm_unpackhi_ps(x0, y0), b = _mm_unpackhi_ps(x1, y0);
+            c = _mm_unpackhi_ps(x1, y1), d = _mm_unpackhi_ps(x0, y1);
+            _mm_storeu_ps(q + 16, _mm_movelh_ps(a, b));
+            _mm_storeu_ps(q + 20, _mm_movelh_ps(c, d));
+            _mm_storeu_ps(q + 24, _mm_movehl_ps(b, a));
+            _mm_storeu_ps(q + 28, _mm_movehl_ps(d, c));
+        }
+        QuadsScalar(x + i, y + i, out + i * 8, count - i, h);
+    }
+#elif defined(SDL_NEON_INTRINSICS)
+    static void IntegrateNEON(float *x, float *y, float *vx, float *vy, float *life, const std::size_t count,
+        const float gx, const float gy, const float dt) {
+        const float32x4_t gdx = vdupq_n_f32(gx * dt);
+        const float32x4_t gdy = vdupq_n_f32(gy * dt);
+        const float32x4_t d = vdupq_n_f32(dt);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const float32x4_t nvx = vaddq_f32(vld1q_f32(vx + i), gdx);
+            const float32x4_t nvy = vaddq_f32(vld1q_f32(vy + i), gdy);
+            vst1q_f32(vx + i, nvx);
+            vst1q_f32(vy + i, nvy);
+            vst1q_f32(x + i, vaddq_f32(vld1q_f32(x + i), vmulq_f32(nvx, d)));
+            vst1q_f32(y + i, vaddq_f32(vld1q_f32(y + i), vmulq_f32(nvy, d)));
+            vst1q_f32(life + i, vsubq_f32(vld1q_f32(life + i), d));
+        }
+        IntegrateScalar(x + i, y + i, vx + i, vy + i, life + i, count - i, gx, gy, dt);
+    }
+
+    static void QuadsNEON(const float *x, const float *y, float *out, const std::size_t count, const float h) {
+        const float32x4_t hs = vdupq_n_f32(h);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const float32x4_t px = vld1q_f32(x + i);
+            const float32x4_t py = vld1q_f32(y + i);
+            const float32x4_t x0 = vsubq_f32(px, hs), x1 = vaddq_f32(px, hs);
+            const float32x4_t y0 = vsubq_f32(py, hs), y1 = vaddq_f32(py, hs);
+            const float32x4x2_t a = vzipq_f32(x0, y0), b = vzipq_f32(x1, y0);
+            const float32x4x2_t c = vzipq_f32(x1, y1), d = vzipq_f32(x0, y1);
+            float *q = out + i * 8;
+            for (int half = 0; half < 2; ++half, q += 16) {
+                vst1q_f32(q, vcombine_f32(vget_low_f32(a.val[half]), vget_low_f32(b.val[half])));
+                vst1q_f32(q + 4, vcombine_f32(vget_low_f32(c.val[half]), vget_low_f32(d.val[half])));
+                vst1q_f32(q + 8, vcombine_f32(vget_high_f32(a.val[half]), vget_high_f32(b.val[half])));
+                vst1q_f32(q + 12, vcombine_f32(vget_high_f32(c.val[half]), vget_high_f32(d.val[half])));
+            }
+        }
+        QuadsScalar(x + i, y + i, out + i * 8, count - i, h);
+    }
+#endif
+
+    ParticleSystem::ParticleSystem(const std::size_t capacity): _capacity(capacity), _x(capacity), _y(capacity), _vx(capacity),
+                                                                _vy(capacity), _life(capacity), _streams(capacity * 4) {
+        std::ranges::fill(_streams.GetColors(), FColor(1, 1, 1, 1));
+        const std::span<FVector2> texCoords = _streams.GetTexCoords();
+        std::vector<int> indices(capacity * 6);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            texCoords[i * 4] = {0, 0};
+            texCoords[i * 4 + 1] = {1, 0};
+            texCoords[i * 4 + 2] = {1, 1};
+            texCoords[i * 4 + 3] = {0, 1};
+            const int base = static_cast<int>(i * 4);
+            const int quad[6] = {base, base + 1, base + 2, base + 2, base + 3, base};
+            std::copy_n(quad, 6, indices.begin() + static_cast<std::ptrdiff_t>(i * 6));
+        }
+        _streams.SetIndices(indices);
+    }
+
+    bool ParticleSystem::Emit(const FVector2 &position, const FVector2 &velocity, const float life, const FColor &color) {
+        if (_count == _capacity)
+            return false;
+        const std::size_t i = _count++;
+        _x[i] = position.x;
+        _y[i] = position.y;
+        _vx[i] = velocity.x;
+        _vy[i] = velocity.y;
+        _life[i] = life;
+        std::fill_n(_streams.GetColors().begin() + static_cast<std::ptrdiff_t>(i * 4), 4, color);
+        WriteQuads(i, 1);
+        return true;
+    }
+
+    void ParticleSystem::Update(const float dt) {
+#if defined(SDL_SSE_INTRINSICS)
+        if (SDL_HasSSE())
+            IntegrateSSE(_x.data(), _y.data(), _vx.data(), _vy.data(), _life.data(), _count, _gravity.x, _gravity.y, dt);
+        else
+            IntegrateScalar(_x.data(), _y.data(), _vx.data(), _vy.data(), _life.data(), _count, _gravity.x, _gravity.y, dt);
+#elif defined(SDL_NEON_INTRINSICS)
+        IntegrateNEON(_x.data(), _y.data(), _vx.data(), _vy.data(), _life.data(), _count, _gravity.x, _gravity.y, dt);
+#else
+        IntegrateScalar(_x.data(), _y.data(), _vx.data(), _vy.data(), _life.data(), _count, _gravity.x, _gravity.y, dt);
+#endif
+        for (std::size_t i = _count; i-- > 0;)
+            if (_life[i] <= 0)
+                Kill(i);
+        WriteQuads(0, _count);
+    }
+
+    void ParticleSystem::Clear() {
+        _count = 0;
+    }
+
+    void ParticleSystem::SetGravity(const FVector2 &gravity) {
+        _gravity = gravity;
+    }
+
+    const FVector2 &ParticleSystem::GetGravity() const {
+        return _gravity;
+    }
+
+    void ParticleSystem::SetSize(const float size) {
+        _size = size;
+        WriteQuads(0, _count);
+    }
+
+    float ParticleSystem::GetSize() const {
+        return _size;
+    }
+
+    void ParticleSystem::SetTexture(const Texture &texture) {
+        _texture = Texture(texture.Get(), Borrowed());
+    }
+
+    void ParticleSystem::SetTexture(std::nullptr_t) {
+        _texture = Texture();
+    }
+
+    std::size_t ParticleSystem::Count() const {
+        return _count;
+    }
+
+    std::size_t ParticleSystem::Capacity() const {
+        return _capacity;
+    }
+
+    void ParticleSystem::Draw(Renderer &renderer) const {
+        if (_count == 0)
+            return;
+        renderer.Draw(_streams.PositionData(), _streams.PositionStride(), _streams.ColorData(), _streams.ColorStride(),
+            _streams.TexCoordData(), _streams.TexCoordStride(), static_cast<int>(_count * 4), _streams.Indices(),
+            static_cast<int>(_count * 6), sizeof(int), _texture);
+    }
+
+    void ParticleSystem::Kill(const std::size_t i) {
+        const std::size_t last = --_count;
+        if (i == last)
+            return;
+        _x[i] = _x[last];
+        _y[i] = _y[last];
+        _vx[i] = _vx[last];
+        _vy[i] = _vy[last];
+        _life[i] = _life[last];
+        const std::span<FColor> colors = _streams.GetColors();
+        std::copy_n(colors.begin() + static_cast<std::ptrdiff_t>(last * 4), 4, colors.begin() + static_cast<std::ptrdiff_t>(i * 4));
+    }
+
+    void ParticleSystem::WriteQuads(const std::size_t first, const std::size_t count) {
+        auto *out = reinterpret_cast<float *>(_streams.GetPositions().data() + first * 4);
+        const float h = _size / 2;
+#if defined(SDL_SSE_INTRINSICS)
+        if (SDL_HasSSE())
+            QuadsSSE(_x.data() + first, _y.data() + first, out, count, h);
+        else
+            QuadsScalar(_x.data() + first, _y.data() + first, out, count, h);
+#elif defined(SDL_NEON_INTRINSICS)
+        QuadsNEON(_x.data() + first, _y.data() + first, out, count, h);
+#else
+        QuadsScalar(_x.data() + first, _y.data() + first, out, count, h);
+#endif
+    }
+}
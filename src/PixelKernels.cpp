@@ -0,0 +1,369 @@
+#include "PixelKernels.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_intrin.h>
+
+namespace SDL::PixelKernels {
+    static constexpr std::size_t StreamThreshold = 64 * 1024;
+
+    static Uint32 Div255(const Uint32 x) {
+        return (x + 1 + (x >> 8)) >> 8;
+    }
+
+    void FillScalar(Uint32 *pixels, const std::size_t count, const Uint32 value) {
+        std::fill_n(pixels, count, value);
+    }
+
+    void PremultiplyScalar(Uint32 *pixels, const std::size_t count, const int alphaShift) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const Uint32 pixel = pixels[i];
+            const Uint32 alpha = pixel >> alphaShift & 0xFF;
+            Uint32 result = alpha << alphaShift;
+            for (int shift = 0; shift < 32; shift += 8)
+                if (shift != alphaShift)
+                    result |= Div255((pixel >> shift & 0xFF) * alpha) << shift;
+            pixels[i] = result;
+        }
+    }
+
+    void UnpremultiplyScalar(Uint32 *pixels, const std::size_t count, const int alphaShift) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const Uint32 pixel = pixels[i];
+            const Uint32 alpha = pixel >> alphaShift & 0xFF;
+            if (alpha == 0)
+                continue;
+            Uint32 result = alpha << alphaShift;
+            for (int shift = 0; shift < 32; shift += 8)
+                if (shift != alphaShift)
+                    result |= std::min<Uint32>(((pixel >> shift & 0xFF) * 255 + alpha / 2) / alpha, 255) << shift;
+            pixels[i] = result;
+        }
+    }
+
+    void ModulateScalar(Uint32 *pixels, const std::size_t count, const Uint32 factors) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const Uint32 pixel = pixels[i];
+            Uint32 result = 0;
+            for (int shift = 0; shift < 32; shift += 8)
+                result |= Div255((pixel >> shift & 0xFF) * (factors >> shift & 0xFF)) << shift;
+            pixels[i] = result;
+        }
+    }
+
+#if defined(SDL_SSE2_INTRINSICS)
+    SDL_TARGETING("sse2") static __m128i Div255SSE2(const __m128i x) {
+        return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+    }
+
+    SDL_TARGETING("sse2") static __m128i MultiplySSE2(const __m128i pixels, const __m128i factors) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(pixels, zero), _mm_unpacklo_epi8(factors, zero));
+        const __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(pixels, zero), _mm_unpackhi_epi8(factors, zero));
+        return _mm_packus_epi16(Div255SSE2(lo), Div255SSE2(hi));
+    }
+
+    SDL_TARGETING("sse2") static void FillSSE2(Uint32 *pixels, const std::size_t count, const Uint32 value) {
+        const __m128i v = _mm_set1_epi32(static_cast<int>(value));
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + i), v);
+        FillScalar(pixels + i, count - i, value);
+    }
+
+    SDL_TARGETING("sse2") static void StreamFillSSE2(Uint32 *pixels, const std::size_t count, const Uint32 value) {
+        if (reinterpret_cast<std::uintptr_t>(pixels) % 4 != 0)
+            return FillSSE2(pixels, count, value);
+        const __m128i v = _mm_set1_epi32(static_cast<int>(value));
+        std::size_t i = 0;
+        for (; i < count && reinterpret_cast<std::uintptr_t>(pixels + i) % 16 != 0; ++i)
+            pixels[i] = value;
+        for (; i + 4 <= count; i += 4)
+            _mm_stream_si128(reinterpret_cast<__m128i *>(pixels + i), v);
+        _mm_sfence();
+        FillScalar(pixels + i, count - i, value);
+    }
+
+    SDL_TARGETING("sse2") static void PremultiplySSE2(Uint32 *pixels, const std::size_t count, const int alphaShift) {
+        const __m128i shift = _mm_cvtsi32_si128(alphaShift);
+        const __m128i mask = _mm_set1_epi32(static_cast<int>(0xFFu << alphaShift));
+        const __m128i byte = _mm_set1_epi32(0xFF);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i *p = reinterpret_cast<__m128i *>(pixels + i);
+            const __m128i v = _mm_loadu_si128(p);
+            __m128i alpha = _mm_and_si128(_mm_srl_epi32(v, shift), byte);
+            alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+            alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+            _mm_storeu_si128(p, MultiplySSE2(v, _mm_or_si128(_mm_andnot_si128(mask, alpha), mask)));
+        }
+        PremultiplyScalar(pixels + i, count - i, alphaShift);
+    }
+
+    SDL_TARGETING("sse2") static void UnpremultiplySSE2(Uint32 *pixels, const std::size_t count, const int alphaShift) {
+        const __m128i alphaCount = _mm_cvtsi32_si128(alphaShift);
+        const __m128i byte = _mm_set1_epi32(0xFF);
+        const __m128 max = _mm_set1_ps(255.0f);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i *p = reinterpret_cast<__m128i *>(pixels + i);
+            const __m128i v = _mm_loadu_si128(p);
+            const __m128i alpha = _mm_and_si128(_mm_srl_epi32(v, alphaCount), byte);
+            const __m128 a = _mm_cvtepi32_ps(alpha);
+            const __m128i half = _mm_srli_epi32(alpha, 1);
+            __m128i result = _mm_sll_epi32(alpha, alphaCount);
+            for (int shift = 0; shift < 32; shift += 8) {
+                if (shift == alphaShift)
+                    continue;
+                const __m128i channelCount = _mm_cvtsi32_si128(shift);
+                const __m128i c = _mm_and_si128(_mm_srl_epi32(v, channelCount), byte);
+                const __m128i n = _mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(c, 8), c), half);
+                const __m128 q = _mm_min_ps(_mm_div_ps(_mm_cvtepi32_ps(n), a), max);
+                result = _mm_or_si128(result, _mm_sll_epi32(_mm_cvttps_epi32(q), channelCount));
+            }
+            const __m128i transparent = _mm_cmpeq_epi32(alpha, _mm_setzero_si128());
+            _mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(transparent, v), _mm_andnot_si128(transparent, result)));
+        }
+        UnpremultiplyScalar(pixels + i, count - i, alphaShift);
+    }
+
+    SDL_TARGETING("sse2") static void ModulateSSE2(Uint32 *pixels, const std::size_t count, const Uint32 factors) {
+        const __m128i f = _mm_set1_epi32(static_cast<int>(factors));
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i *p = reinterpret_cast<__m128i *>(pixels + i);
+            _mm_storeu_si128(p, MultiplySSE2(_mm_loadu_si128(p), f));
+        }
+        ModulateScalar(pixels + i, count - i, factors);
+    }
+#elif defined(SDL_NEON_INTRINSICS)
+    static uint8x8_t Div255NEON(const uint16x8_t x) {
+        return vshrn_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8);
+    }
+
+    static uint32x4_t MultiplyNEON(const uint32x4_t pixels, const uint32x4_t factors) {
+        const uint8x16_t p = vreinterpretq_u8_u32(pixels), f = vreinterpretq_u8_u32(factors);
+        const uint16x8_t lo = vmull_u8(vget_low_u8(p), vget_low_u8(f));
+        const uint16x8_t hi = vmull_u8(vget_high_u8(p), vget_high_u8(f));
+        return vreinterpretq_u32_u8(vcombine_u8(Div255NEON(lo), Div255NEON(hi)));
+    }
+
+    static void FillNEON(Uint32 *pixels, const std::size_t count, const Uint32 value) {
+        const uint32x4_t v = vdupq_n_u32(value);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+            vst1q_u32(pixels + i, v);
+        FillScalar(pixels + i, count - i, value);
+    }
+
+    static void PremultiplyNEON(Uint32 *pixels, const std::size_t count, const int alphaShift) {
+        const int32x4_t shift = vdupq_n_s32(-alphaShift);
+        const uint32x4_t mask = vdupq_n_u32(0xFFu << alphaShift);
+        const uint32x4_t byte = vdupq_n_u32(0xFF);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const uint32x4_t v = vld1q_u32(pixels + i);
+            const uint32x4_t alpha = vmulq_n_u32(vandq_u32(vshlq_u32(v, shift), byte), 0x01010101u);
+            vst1q_u32(pixels + i, MultiplyNEON(v, vorrq_u32(vbicq_u32(alpha, mask), mask)));
+        }
+        PremultiplyScalar(pixels + i, count - i, alphaShift);
+    }
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+    static void UnpremultiplyNEON(Uint32 *pixels, const std::size_t count, const int alphaShift) {
+        const uint32x4_t byte = vdupq_n_u32(0xFF);
+        const float32x4_t max = vdupq_n_f32(255.0f);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const uint32x4_t v = vld1q_u32(pixels + i);
+            const uint32x4_t alpha = vandq_u32(vshlq_u32(v, vdupq_n_s32(-alphaShift)), byte);
+            const float32x4_t a = vcvtq_f32_u32(alpha);
+            const uint32x4_t half = vshrq_n_u32(alpha, 1);
+            uint32x4_t result = vshlq_u32(alpha, vdupq_n_s32(alphaShift));
+            for (int shift = 0; shift < 32; shift += 8) {
+                if (shift == alphaShift)
+                    continue;
+                const uint32x4_t c = vandq_u32(vshlq_u32(v, vdupq_n_s32(-shift)), byte);
+                const uint32x4_t n = vaddq_u32(vmulq_n_u32(c, 255), half);
+                const float32x4_t q = vminq_f32(vdivq_f32(vcvtq_f32_u32(n), a), max);
+                result = vorrq_u32(result, vshlq_u32(vcvtq_u32_f32(q), vdupq_n_s32(shift)));
+            }
+            vst1q_u32(pixels + i, vbslq_u32(vceqq_u32(alpha, vdupq_n_u32(0)), v, result));
+        }
+        UnpremultiplyScalar(pixels + i, count - i, alphaShift);
+    }
+#endif
+
+    static void ModulateNEON(Uint32 *pixels, const std::size_t count, const Uint32 factors) {
+        const uint32x4_t f = vdupq_n_u32(factors);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+            vst1q_u32(pixels + i, MultiplyNEON(vld1q_u32(pixels + i), f));
+        ModulateScalar(pixels + i, count - i, factors);
+    }
+#endif
+
+#if defined(SDL_AVX2_INTRINSICS)
+    SDL_TARGETING("avx2") static __m256i Div255AVX2(const __m256i x) {
+        return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_srli_epi16(x, 8)), 8);
+    }
+
+    SDL_TARGETING("avx2") static __m256i MultiplyAVX2(const __m256i pixels, const __m256i factors) {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(pixels, zero), _mm256_unpacklo_epi8(factors, zero));
+        const __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(pixels, zero), _mm256_unpackhi_epi8(factors, zero));
+        return _mm256_packus_epi16(Div255AVX2(lo), Div255AVX2(hi));
+    }
+
+    SDL_TARGETING("avx2") static void FillAVX2(Uint32 *pixels, const std::size_t count, const Uint32 value) {
+        const __m256i v = _mm256_set1_epi32(static_cast<int>(value));
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(pixels + i), v);
+        FillScalar(pixels + i, count - i, value);
+    }
+
+    SDL_TARGETING("avx2") static void StreamFillAVX2(Uint32 *pixels, const std::size_t count, const Uint32 value) {
+        if (reinterpret_cast<std::uintptr_t>(pixels) % 4 != 0)
+            return FillAVX2(pixels, count, value);
+        const __m256i v = _mm256_set1_epi32(static_cast<int>(value));
+        std::size_t i = 0;
+        for (; i < count && reinterpret_cast<std::uintptr_t>(pixels + i) % 32 != 0; ++i)
+            pixels[i] = value;
+        for (; i + 8 <= count; i += 8)
+            _mm256_stream_si256(reinterpret_cast<__m256i *>(pixels + i), v);
+        _mm_sfence();
+        FillScalar(pixels + i, count - i, value);
+    }
+
+    SDL_TARGETING("avx2") static void PremultiplyAVX2(Uint32 *pixels, const std::size_t count, const int alphaShift) {
+        const __m128i shift = _mm_cvtsi32_si128(alphaShift);
+        const __m256i mask = _mm256_set1_epi32(static_cast<int>(0xFFu << alphaShift));
+        const __m256i byte = _mm256_set1_epi32(0xFF);
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256i *p = reinterpret_cast<__m256i *>(pixels + i);
+            const __m256i v = _mm256_loadu_si256(p);
+            __m256i alpha = _mm256_and_si256(_mm256_srl_epi32(v, shift), byte);
+            alpha = _mm256_or_si256(alpha, _mm256_slli_epi32(alpha, 8));
+            alpha = _mm256_or_si256(alpha, _mm256_slli_epi32(alpha, 16));
+            _mm256_storeu_si256(p, MultiplyAVX2(v, _mm256_or_si256(_mm256_andnot_si256(mask, alpha), mask)));
+        }
+        PremultiplyScalar(pixels + i, count - i, alphaShift);
+    }
+
+    SDL_TARGETING("avx2") static void UnpremultiplyAVX2(Uint32 *pixels, const std::size_t count, const int alphaShift) {
+        const __m128i alphaCount = _mm_cvtsi32_si128(alphaShift);
+        const __m256i byte = _mm256_set1_epi32(0xFF);
+        const __m256 max = _mm256_set1_ps(255.0f);
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256i *p = reinterpret_cast<__m256i *>(pixels + i);
+            const __m256i v = _mm256_loadu_si256(p);
+            const __m256i alpha = _mm256_and_si256(_mm256_srl_epi32(v, alphaCount), byte);
+            const __m256 a = _mm256_cvtepi32_ps(alpha);
+            const __m256i half = _mm256_srli_epi32(alpha, 1);
+            __m256i result = _mm256_sll_epi32(alpha, alphaCount);
+            for (int shift = 0; shift < 32; shift += 8) {
+                if (shift == alphaShift)
+                    continue;
+                const __m128i channelCount = _mm_cvtsi32_si128(shift);
+                const __m256i c = _mm256_and_si256(_mm256_srl_epi32(v, channelCount), byte);
+                const __m256i n = _mm256_add_epi32(_mm256_sub_epi32(_mm256_slli_epi32(c, 8), c), half);
+                const __m256 q = _mm256_min_ps(_mm256_div_ps(_mm256_cvtepi32_ps(n), a), max);
+                result = _mm256_or_si256(result, _mm256_sll_epi32(_mm256_cvttps_epi32(q), channelCount));
+            }
+            const __m256i transparent = _mm256_cmpeq_epi32(alpha, _mm256_setzero_si256());
+            _mm256_storeu_si256(p, _mm256_blendv_epi8(result, v, transparent));
+        }
+        UnpremultiplyScalar(pixels + i, count - i, alphaShift);
+    }
+
+    SDL_TARGETING("avx2") static void ModulateAVX2(Uint32 *pixels, const std::size_t count, const Uint32 factors) {
+        const __m256i f = _mm256_set1_epi32(static_cast<int>(factors));
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256i *p = reinterpret_cast<__m256i *>(pixels + i);
+            _mm256_storeu_si256(p, MultiplyAVX2(_mm256_loadu_si256(p), f));
+        }
+        ModulateScalar(pixels + i, count - i, factors);
+    }
+#endif
+
+    static FillKernel ResolveFill(const bool stream) {
+#if defined(SDL_AVX2_INTRINSICS)
+        if (SDL_HasAVX2())
+            return stream ? StreamFillAVX2 : FillAVX2;
+#endif
+#if defined(SDL_SSE2_INTRINSICS)
+        if (SDL_HasSSE2())
+            return stream ? StreamFillSSE2 : FillSSE2;
+#elif defined(SDL_NEON_INTRINSICS)
+        return FillNEON;
+#endif
+        return FillScalar;
+    }
+
+    static AlphaKernel ResolvePremultiply() {
+#if defined(SDL_AVX2_INTRINSICS)
+        if (SDL_HasAVX2())
+            return PremultiplyAVX2;
+#endif
+#if defined(SDL_SSE2_INTRINSICS)
+        if (SDL_HasSSE2())
+            return PremultiplySSE2;
+#elif defined(SDL_NEON_INTRINSICS)
+        return PremultiplyNEON;
+#endif
+        return PremultiplyScalar;
+    }
+
+    static AlphaKernel ResolveUnpremultiply() {
+#if defined(SDL_AVX2_INTRINSICS)
+        if (SDL_HasAVX2())
+            return UnpremultiplyAVX2;
+#endif
+#if defined(SDL_SSE2_INTRINSICS)
+        if (SDL_HasSSE2())
+            return UnpremultiplySSE2;
+#elif defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+        return UnpremultiplyNEON;
+#endif
+        return UnpremultiplyScalar;
+    }
+
+    static ModulateKernel ResolveModulate() {
+#if defined(SDL_AVX2_INTRINSICS)
+        if (SDL_HasAVX2())
+            return ModulateAVX2;
+#endif
+#if defined(SDL_SSE2_INTRINSICS)
+        if (SDL_HasSSE2())
+            return ModulateSSE2;
+#elif defined(SDL_NEON_INTRINSICS)
+        return ModulateNEON;
+#endif
+        return ModulateScalar;
+    }
+
+    FillKernel GetFill(const std::size_t count) {
+        static const FillKernel kernel = ResolveFill(false), streamKernel = ResolveFill(true);
+        return count >= StreamThreshold ? streamKernel : kernel;
+    }
+
+    AlphaKernel GetPremultiply() {
+        static const AlphaKernel kernel = ResolvePremultiply();
+        return kernel;
+    }
+
+    AlphaKernel GetUnpremultiply() {
+        static const AlphaKernel kernel = ResolveUnpremultiply();
+        return kernel;
+    }
+
+    ModulateKernel GetModulate() {
+        static const ModulateKernel kernel = ResolveModulate();
+        return kernel;
+    }
+}
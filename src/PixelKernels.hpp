@@ -0,0 +1,25 @@
+#ifndef PIXELKERNELS_HPP
+#define PIXELKERNELS_HPP
+#include <cstddef>
+#include <SDL3/SDL_stdinc.h>
+
+namespace SDL::PixelKernels {
+    using FillKernel = void (*)(Uint32 *pixels, std::size_t count, Uint32 value);
+    using AlphaKernel = void (*)(Uint32 *pixels, std::size_t count, int alphaShift);
+    using ModulateKernel = void (*)(Uint32 *pixels, std::size_t count, Uint32 factors);
+
+    // Each getter picks the best implementation for the running CPU once; callers fetch it before their row loop.
+    // GetFill takes the total pixel count so large fills can bypass the cache with streaming stores.
+    [[nodiscard]] FillKernel GetFill(std::size_t count);
+    [[nodiscard]] AlphaKernel GetPremultiply();
+    [[nodiscard]] AlphaKernel GetUnpremultiply();
+    [[nodiscard]] ModulateKernel GetModulate();
+
+    // Portable fallbacks the getters return when no vector path applies; exposed so benchmarks can compare against them.
+    void FillScalar(Uint32 *pixels, std::size_t count, Uint32 value);
+    void PremultiplyScalar(Uint32 *pixels, std::size_t count, int alphaShift);
+    void UnpremultiplyScalar(Uint32 *pixels, std::size_t count, int alphaShift);
+    void ModulateScalar(Uint32 *pixels, std::size_t count, Uint32 factors);
+}
+
+#endif //PIXELKERNELS_HPP
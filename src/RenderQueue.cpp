@@ -0,0 +1,112 @@
+#include "SDLPP/RenderQueue.hpp"
+
+#include <algorithm>
+
+namespace SDL {
+    RenderQueue::RenderQueue() = default;
+
+    void RenderQueue::Add(const SDL_Vertex *vertices, const int vertexCount, const int *indices, const int indexCount,
+        SDL_Texture *texture, const SDL_BlendMode blendMode, const int layer, const std::optional<Rect<>> &clipRect) {
+        if (vertexCount <= 0)
+            return;
+
+        auto clip = std::find(_clipRects.begin(), _clipRects.end(), clipRect);
+        if (clip == _clipRects.end())
+            clip = _clipRects.insert(_clipRects.end(), clipRect);
+
+        const std::size_t textureId = _textureIds.try_emplace(texture, _textureIds.size()).first->second;
+
+        _commands.push_back({
+            layer, static_cast<std::size_t>(clip - _clipRects.begin()), texture, textureId, blendMode,
+            _vertices.size(), vertexCount, _indices.size(), indices ? indexCount : 0
+        });
+        _vertices.insert(_vertices.end(), vertices, vertices + vertexCount);
+        if (indices)
+            _indices.insert(_indices.end(), indices, indices + indexCount);
+    }
+
+    void RenderQueue::SetUnordered(const int layer, const bool unordered) {
+        const auto it = std::ranges::find(_unorderedLayers, layer);
+        if (unordered && it == _unorderedLayers.end())
+            _unorderedLayers.push_back(layer);
+        else if (!unordered && it != _unorderedLayers.end())
+            _unorderedLayers.erase(it);
+    }
+
+    bool RenderQueue::IsUnordered(const int layer) const {
+        return std::ranges::find(_unorderedLayers, layer) != _unorderedLayers.end();
+    }
+
+    void RenderQueue::Sort() {
+        _changesBefore = CountStateChanges();
+        std::stable_sort(_commands.begin(), _commands.end(), [this](const Command &a, const Command &b) {
+            if (a.layer != b.layer)
+                return a.layer < b.layer;
+            if (!IsUnordered(a.layer))
+                return false;
+            if (a.clipRect != b.clipRect)
+                return a.clipRect < b.clipRect;
+            if (a.textureId != b.textureId)
+                return a.textureId < b.textureId;
+            return a.blendMode < b.blendMode;
+        });
+        _changesAfter = CountStateChanges();
+    }
+
+    void RenderQueue::Clear() {
+        _vertices.clear();
+        _indices.clear();
+        _commands.clear();
+        _clipRects.clear();
+        _textureIds.clear();
+    }
+
+    bool RenderQueue::Empty() const {
+        return _commands.empty();
+    }
+
+    std::size_t RenderQueue::CommandCount() const {
+        return _commands.size();
+    }
+
+    const std::vector<RenderQueue::Command> &RenderQueue::GetCommands() const {
+        return _commands;
+    }
+
+    const std::optional<Rect<>> &RenderQueue::GetClipRect(const Command &command) const {
+        return _clipRects[command.clipRect];
+    }
+
+    const SDL_Vertex *RenderQueue::GetVertices(const Command &command) const {
+        return _vertices.data() + command.vertexOffset;
+    }
+
+    const int *RenderQueue::GetIndices(const Command &command) const {
+        if (command.indexCount == 0)
+            return nullptr;
+        return _indices.data() + command.indexOffset;
+    }
+
+    std::size_t RenderQueue::GetStateChangesBeforeSort() const {
+        return _changesBefore;
+    }
+
+    std::size_t RenderQueue::GetStateChangesAfterSort() const {
+        return _changesAfter;
+    }
+
+    std::size_t RenderQueue::CountStateChanges() const {
+        std::size_t changes = 0;
+        for (std::size_t i = 0; i < _commands.size(); ++i) {
+            const Command &command = _commands[i];
+            if (i == 0) {
+                ++changes;
+                continue;
+            }
+            const Command &previous = _commands[i - 1];
+            if (command.clipRect != previous.clipRect || command.texture != previous.texture || command.blendMode != previous.blendMode)
+                ++changes;
+        }
+        return changes;
+    }
+}
@@ -0,0 +1,98 @@
+#include "SDLPP/RenderTargetPool.hpp"
+
+#include <functional>
+
+#include "SDLPP/Renderer.hpp"
+
+namespace SDL {
+    bool RenderTargetPool::Key::operator==(const Key &other) const {
+        return size == other.size && format == other.format && access == other.access;
+    }
+
+    std::size_t RenderTargetPool::KeyHash::operator()(const Key &key) const {
+        std::size_t hash = std::hash<unsigned int>()(key.size.x);
+        hash = hash * 31 + std::hash<unsigned int>()(key.size.y);
+        hash = hash * 31 + std::hash<int>()(key.format);
+        return hash * 31 + std::hash<int>()(key.access);
+    }
+
+    RenderTargetPool::RenderTargetPool(const Renderer &renderer, const unsigned int maxIdleFrames): _renderer(renderer), _maxIdleFrames(maxIdleFrames) {
+
+    }
+
+    Texture &RenderTargetPool::Acquire(const UVector2 &size, const SDL_PixelFormat format, const SDL_TextureAccess access) {
+        std::vector<std::unique_ptr<Entry>> &bucket = _buckets[{size, format, access}];
+        for (const std::unique_ptr<Entry> &entry : bucket) {
+            if (entry->leased)
+                continue;
+            entry->leased = true;
+            entry->lastUsed = _frame;
+            ++_stats.hits;
+            return entry->texture;
+        }
+
+        auto entry = std::make_unique<Entry>();
+        entry->texture.Create(_renderer, size, format, access);
+        entry->leased = true;
+        entry->lastUsed = _frame;
+        ++_stats.misses;
+        bucket.push_back(std::move(entry));
+        return bucket.back()->texture;
+    }
+
+    void RenderTargetPool::Release(const Texture &texture) {
+        for (auto &[key, bucket] : _buckets) {
+            for (const std::unique_ptr<Entry> &entry : bucket) {
+                if (entry->texture.Get() == texture.Get()) {
+                    entry->leased = false;
+                    return;
+                }
+            }
+        }
+    }
+
+    void RenderTargetPool::EndFrame() {
+        for (auto it = _buckets.begin(); it != _buckets.end();) {
+            std::vector<std::unique_ptr<Entry>> &bucket = it->second;
+            std::erase_if(bucket, [this](const std::unique_ptr<Entry> &entry) {
+                entry->leased = false;
+                if (_frame - entry->lastUsed < _maxIdleFrames)
+                    return false;
+                ++_stats.evictions;
+                return true;
+            });
+            if (bucket.empty())
+                it = _buckets.erase(it);
+            else
+                ++it;
+        }
+        ++_frame;
+    }
+
+    void RenderTargetPool::Clear() {
+        _buckets.clear();
+    }
+
+    std::size_t RenderTargetPool::GetPooledCount() const {
+        std::size_t count = 0;
+        for (const auto &[key, bucket] : _buckets)
+            count += bucket.size();
+        return count;
+    }
+
+    std::size_t RenderTargetPool::GetLeasedCount() const {
+        std::size_t count = 0;
+        for (const auto &[key, bucket] : _buckets)
+            for (const std::unique_ptr<Entry> &entry : bucket)
+                count += entry->leased;
+        return count;
+    }
+
+    const RenderTargetPool::Stats &RenderTargetPool::GetStats() const {
+        return _stats;
+    }
+
+    void RenderTargetPool::ResetStats() {
+        _stats = {};
+    }
+}
@@ -1,4 +1,7 @@
 ﻿#include "SDLPP/Renderer.hpp"
+
+#include <algorithm>
+
 #include "SDLPP/Error.hpp"
 
 namespace SDL {
@@ -12,14 +15,9 @@ namespace SDL {
             Error::Throw("SDL_CreateRendererWithProperties");
     }
 
-    Renderer::Renderer(Renderer &&renderer) noexcept: _renderer(std::move(renderer._renderer)) {
-
-    }
+    Renderer::Renderer(Renderer &&renderer) noexcept = default;
 
-    Renderer &Renderer::operator=(Renderer &&renderer) noexcept {
-        _renderer = std::move(renderer._renderer);
-        return *this;
-    }
+    Renderer &Renderer::operator=(Renderer &&renderer) noexcept = default;
 
     Renderer::Renderer(const class Window &window, const std::string &name): _renderer(SDL_CreateRenderer(window, name.c_str())) {
         if (!_renderer)
@@ -43,13 +41,31 @@ namespace SDL {
     }
 
     void Renderer::SetTarget(std::nullptr_t) {
+        if (_state.target && *_state.target == nullptr) {
+            ++_stateStats.skipped;
+            return;
+        }
+        Flush();
         if (!SDL_SetRenderTarget(_renderer, nullptr))
             Error::Throw("SDL_SetRenderTarget");
+        _state.target = nullptr;
+        _state.viewport.reset();
+        _state.clipRect.reset();
+        ++_stateStats.applied;
     }
 
     void Renderer::SetTarget(Texture &texture) {
+        if (_state.target && *_state.target == texture.Get() && SDL_GetRenderTarget(_renderer) == texture.Get()) {
+            ++_stateStats.skipped;
+            return;
+        }
+        Flush();
         if (!SDL_SetRenderTarget(_renderer, texture.Get()))
             Error::Throw("SDL_SetRenderTarget");
+        _state.target = texture.Get();
+        _state.viewport.reset();
+        _state.clipRect.reset();
+        ++_stateStats.applied;
     }
 
     SDL_Renderer *Renderer::Get() const {
@@ -60,52 +76,315 @@ namespace SDL {
         return _renderer;
     }
 
+    SDL_Renderer *Renderer::Raw() {
+        Flush();
+        InvalidateState();
+        return _renderer;
+    }
+
     void Renderer::SetDrawColor(const Color &color) {
-        if (!SDL_SetRenderDrawColor(_renderer, color.r, color.g, color.b, color.a))
-            Error::Throw("SDL_SetRenderDrawColor");
+        _drawColor = color;
+        ApplyDrawColor(color);
     }
 
     Color Renderer::GetDrawColor() const {
+        if (_drawColor)
+            return *_drawColor;
         Color color;
         if (!SDL_GetRenderDrawColor(_renderer, &color.r, &color.g, &color.b, &color.a))
             Error::Throw("SDL_GetRenderDrawColor");
+        _drawColor = color;
+        _state.drawColor = color;
         return color;
     }
 
+    void Renderer::SetDrawBlendMode(const SDL_BlendMode blendMode) {
+        if (_state.drawBlendMode != blendMode)
+            SubmitQueue();
+        ApplyDrawBlendMode(blendMode);
+    }
+
+    SDL_BlendMode Renderer::GetDrawBlendMode() const {
+        if (_state.drawBlendMode)
+            return *_state.drawBlendMode;
+        SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+        if (!SDL_GetRenderDrawBlendMode(_renderer, &blendMode))
+            Error::Throw("SDL_GetRenderDrawBlendMode");
+        _state.drawBlendMode = blendMode;
+        return blendMode;
+    }
+
     void Renderer::Clear() {
+        Flush();
+        ApplyDrawColor(GetDrawColor());
         if (!SDL_RenderClear(_renderer))
             Error::Throw("SDL_RenderClear");
     }
 
     void Renderer::Clear(const Color &color) {
-        const Color tmp = GetDrawColor();
-        SetDrawColor(color);
+        Flush();
+        const Color drawColor = GetDrawColor();
+        ApplyDrawColor(color);
         if (!SDL_RenderClear(_renderer))
             Error::Throw("SDL_RenderClear");
-        SetDrawColor(tmp);
+        if (drawColor != color)
+            ApplyDrawColor(drawColor);
     }
 
     void Renderer::Draw(const SDL_Vertex *vertices, const int vertexCount, const Texture &texture) {
-        if (!SDL_RenderGeometry(_renderer, texture ? texture.Get() : nullptr, vertices, vertexCount, nullptr, 0))
-            Error::Throw("SDL_RenderGeometry");
+        Draw(vertices, vertexCount, nullptr, 0, texture);
     }
 
     void Renderer::Draw(const SDL_Vertex *vertices, const int vertexCount, const int *indices, const int indexCount,
         const Texture &texture) {
-        if (!SDL_RenderGeometry(_renderer, texture ? texture.Get() : nullptr, vertices, vertexCount, indices, indexCount))
-            Error::Throw("SDL_RenderGeometry");
+        DrawGeometry(vertices, vertexCount, indices, indexCount, texture ? texture.Get() : nullptr);
+    }
+
+    void Renderer::Draw(const std::span<const Vertex> vertices, const Texture &texture) {
+        Draw(AsSDLVertices(vertices.data()), static_cast<int>(vertices.size()), nullptr, 0, texture);
+    }
+
+    void Renderer::Draw(const std::span<const Vertex> vertices, const std::span<const int> indices, const Texture &texture) {
+        Draw(AsSDLVertices(vertices.data()), static_cast<int>(vertices.size()), indices.data(), static_cast<int>(indices.size()), texture);
     }
 
     void Renderer::Draw(const VertexBuffer &vertices, const Texture &texture) {
-        if (!SDL_RenderGeometry(_renderer, texture ? texture.Get() : nullptr, vertices.Vertices(), static_cast<int>(vertices.VertexCount()), vertices.Indices(), static_cast<int>(vertices.IndexCount())))
-            Error::Throw("SDL_RenderGeometry");
+        const int vertexCount = static_cast<int>(vertices.VertexCount());
+        const int indexCount = static_cast<int>(vertices.IndexCount());
+        if (vertexCount == 0 || !vertices.IndexData() || vertices.GetIndexSize() == sizeof(int)) {
+            Draw(vertices.Vertices(), vertexCount, static_cast<const int *>(vertices.IndexData()), indexCount, texture);
+            return;
+        }
+        if (_deferred || _batching) {
+            static thread_local std::vector<int> indices;
+            indices.resize(indexCount);
+            ConvertIndices(vertices.IndexData(), vertices.GetIndexSize(), indexCount, indices.data());
+            Draw(vertices.Vertices(), vertexCount, indices.data(), indexCount, texture);
+            return;
+        }
+        const SDL_Vertex *data = vertices.Vertices();
+        Draw(&data->position.x, sizeof(SDL_Vertex), &data->color, sizeof(SDL_Vertex), &data->tex_coord.x, sizeof(SDL_Vertex),
+            vertexCount, vertices.IndexData(), indexCount, vertices.GetIndexSize(), texture);
+    }
+
+    void Renderer::Draw(const VertexStreams &streams, const Texture &texture) {
+        Draw(streams.PositionData(), streams.PositionStride(), streams.ColorData(), streams.ColorStride(), streams.TexCoordData(),
+            streams.TexCoordStride(), static_cast<int>(streams.VertexCount()), streams.Indices(), static_cast<int>(streams.IndexCount()), sizeof(int),
+            texture);
+    }
+
+    void Renderer::Draw(const float *positions, const int positionStride, const SDL_FColor *colors, const int colorStride,
+        const float *texCoords, const int texCoordStride, const int vertexCount, const void *indices, const int indexCount,
+        const int indexSize, const Texture &texture) {
+        if (_deferred) {
+            static thread_local std::vector<SDL_Vertex> vertices;
+            vertices.resize(vertexCount);
+            const auto *xy = reinterpret_cast<const unsigned char *>(positions);
+            const auto *color = reinterpret_cast<const unsigned char *>(colors);
+            const auto *uv = reinterpret_cast<const unsigned char *>(texCoords);
+            for (int i = 0; i < vertexCount; ++i) {
+                const auto *position = reinterpret_cast<const float *>(xy + static_cast<std::ptrdiff_t>(i) * positionStride);
+                vertices[i].position = {position[0], position[1]};
+                vertices[i].color = *reinterpret_cast<const SDL_FColor *>(color + static_cast<std::ptrdiff_t>(i) * colorStride);
+                if (uv) {
+                    const auto *texCoord = reinterpret_cast<const float *>(uv + static_cast<std::ptrdiff_t>(i) * texCoordStride);
+                    vertices[i].tex_coord = {texCoord[0], texCoord[1]};
+                } else {
+                    vertices[i].tex_coord = {0, 0};
+                }
+            }
+            static thread_local std::vector<int> wideIndices;
+            if (indices) {
+                wideIndices.resize(indexCount);
+                ConvertIndices(indices, indexSize, indexCount, wideIndices.data());
+            }
+            DrawGeometry(vertices.data(), vertexCount, indices ? wideIndices.data() : nullptr, indexCount, texture ? texture.Get() : nullptr);
+            return;
+        }
+        _batch.Flush(_renderer);
+        if (!SDL_RenderGeometryRaw(_renderer, texture ? texture.Get() : nullptr, positions, positionStride, colors, colorStride,
+            texCoords, texCoordStride, vertexCount, indices, indexCount, indices ? indexSize : 0))
+            Error::Throw("SDL_RenderGeometryRaw");
     }
 
     void Renderer::Draw(const Drawable &drawable) {
         drawable.Draw(*this);
     }
 
+    void Renderer::Draw(const CommandList &list) {
+        for (const CommandList::Command &command : list.GetCommands())
+            DrawGeometry(list.GetVertices(command), command.vertexCount, list.GetIndices(command), command.indexCount, command.texture);
+    }
+
+    void Renderer::Draw(const std::span<const CommandList> lists) {
+        for (const CommandList &list : lists)
+            Draw(list);
+    }
+
+    void Renderer::SetBatching(const bool enable) {
+        if (!enable)
+            Flush();
+        _batching = enable;
+    }
+
+    bool Renderer::IsBatching() const {
+        return _batching;
+    }
+
+    void Renderer::Flush() {
+        SubmitQueue();
+        _batch.Flush(_renderer);
+    }
+
+    const SpriteBatch &Renderer::GetBatch() const {
+        return _batch;
+    }
+
+    void Renderer::ResetBatchStats() {
+        _batch.ResetStats();
+    }
+
+    void Renderer::SetDeferred(const bool enable) {
+        if (enable == _deferred)
+            return;
+        if (enable) {
+            _clipRect.reset();
+            if (SDL_RenderClipEnabled(_renderer))
+                _clipRect = GetClipRect();
+        } else {
+            Flush();
+        }
+        _deferred = enable;
+    }
+
+    bool Renderer::IsDeferred() const {
+        return _deferred;
+    }
+
+    void Renderer::SetLayer(const int layer) {
+        _layer = layer;
+    }
+
+    int Renderer::GetLayer() const {
+        return _layer;
+    }
+
+    void Renderer::SetLayerUnordered(const int layer, const bool unordered) {
+        _queue.SetUnordered(layer, unordered);
+    }
+
+    bool Renderer::IsLayerUnordered(const int layer) const {
+        return _queue.IsUnordered(layer);
+    }
+
+    const RenderQueue &Renderer::GetQueue() const {
+        return _queue;
+    }
+
+    void Renderer::DrawGeometry(const SDL_Vertex *vertices, const int vertexCount, const int *indices, const int indexCount,
+        SDL_Texture *texture) {
+        if (!_deferred) {
+            Submit(vertices, vertexCount, indices, indexCount, texture);
+            return;
+        }
+        SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+        if (!texture)
+            blendMode = GetDrawBlendMode();
+        else if (!SDL_GetTextureBlendMode(texture, &blendMode))
+            Error::Throw("SDL_GetTextureBlendMode");
+        _queue.Add(vertices, vertexCount, indices, indexCount, texture, blendMode, _layer, _clipRect);
+    }
+
+    void Renderer::Submit(const SDL_Vertex *vertices, const int vertexCount, const int *indices, const int indexCount,
+        SDL_Texture *texture) {
+        if (_batching) {
+            _batch.Add(_renderer, vertices, vertexCount, indices, indexCount, texture);
+            return;
+        }
+        if (!SDL_RenderGeometry(_renderer, texture, vertices, vertexCount, indices, indexCount))
+            Error::Throw("SDL_RenderGeometry");
+    }
+
+    void Renderer::SubmitQueue() {
+        if (_queue.Empty())
+            return;
+        _queue.Sort();
+
+        const SDL_BlendMode drawBlendMode = GetDrawBlendMode();
+        for (const RenderQueue::Command &command : _queue.GetCommands()) {
+            ApplyClipRect(_queue.GetClipRect(command));
+            if (!command.texture)
+                ApplyDrawBlendMode(command.blendMode);
+            else
+                ApplyTextureBlendMode(command.texture, command.blendMode);
+            Submit(_queue.GetVertices(command), command.vertexCount, _queue.GetIndices(command), command.indexCount, command.texture);
+        }
+        _batch.Flush(_renderer);
+        _queue.Clear();
+        for (const auto &[texture, blendMode] : _textureBlendModes)
+            if (!SDL_SetTextureBlendMode(texture, blendMode))
+                Error::Throw("SDL_SetTextureBlendMode");
+        _textureBlendModes.clear();
+
+        ApplyClipRect(_clipRect);
+        ApplyDrawBlendMode(drawBlendMode);
+    }
+
+    void Renderer::ApplyDrawColor(const Color &color) const {
+        if (_state.drawColor == color) {
+            ++_stateStats.skipped;
+            return;
+        }
+        if (!SDL_SetRenderDrawColor(_renderer, color.r, color.g, color.b, color.a))
+            Error::Throw("SDL_SetRenderDrawColor");
+        _state.drawColor = color;
+        ++_stateStats.applied;
+    }
+
+    void Renderer::ApplyTextureBlendMode(SDL_Texture *texture, const SDL_BlendMode blendMode) {
+        SDL_BlendMode current = SDL_BLENDMODE_NONE;
+        if (!SDL_GetTextureBlendMode(texture, &current))
+            Error::Throw("SDL_GetTextureBlendMode");
+        if (current == blendMode)
+            return;
+        if (std::ranges::find(_textureBlendModes, texture, &std::pair<SDL_Texture *, SDL_BlendMode>::first) == _textureBlendModes.end())
+            _textureBlendModes.emplace_back(texture, current);
+        _batch.Flush(_renderer);
+        if (!SDL_SetTextureBlendMode(texture, blendMode))
+            Error::Throw("SDL_SetTextureBlendMode");
+    }
+
+    void Renderer::ApplyDrawBlendMode(const SDL_BlendMode blendMode) {
+        if (_state.drawBlendMode == blendMode) {
+            ++_stateStats.skipped;
+            return;
+        }
+        _batch.Flush(_renderer);
+        if (!SDL_SetRenderDrawBlendMode(_renderer, blendMode))
+            Error::Throw("SDL_SetRenderDrawBlendMode");
+        _state.drawBlendMode = blendMode;
+        ++_stateStats.applied;
+    }
+
+    void Renderer::ApplyClipRect(const std::optional<Rect<>> &rect) {
+        if (_state.clipRect && *_state.clipRect == rect) {
+            ++_stateStats.skipped;
+            return;
+        }
+        _batch.Flush(_renderer);
+        const SDL_Rect cr = rect.value_or(SDL_Rect());
+        if (!SDL_SetRenderClipRect(_renderer, rect ? &cr : nullptr))
+            Error::Throw("SDL_SetRenderClipRect");
+        _state.clipRect = rect;
+        ++_stateStats.applied;
+    }
+
     void Renderer::SetViewport(const std::optional<Rect<>> &rect) {
+        if (_state.viewport && *_state.viewport == rect) {
+            ++_stateStats.skipped;
+            return;
+        }
+        Flush();
         if (rect) {
             const SDL_Rect vp = rect.value();
             if (!SDL_SetRenderViewport(_renderer, &vp))
@@ -114,6 +393,8 @@ namespace SDL {
             if (!SDL_SetRenderViewport(_renderer, nullptr))
                 Error::Throw("SDL_SetRenderViewport");
         }
+        _state.viewport = rect;
+        ++_stateStats.applied;
     }
 
     Rect<> Renderer::GetViewport() const {
@@ -124,17 +405,16 @@ namespace SDL {
     }
 
     void Renderer::SetClipRect(const std::optional<Rect<>> &rect) {
-        if (rect) {
-            const SDL_Rect cr = rect.value();
-            if (!SDL_SetRenderClipRect(_renderer, &cr))
-                Error::Throw("SDL_SetRenderClipRect");
-        } else {
-            if (!SDL_SetRenderClipRect(_renderer, nullptr))
-                Error::Throw("SDL_SetRenderClipRect");
+        if (_deferred) {
+            _clipRect = rect;
+            return;
         }
+        ApplyClipRect(rect);
     }
 
     Rect<> Renderer::GetClipRect() const {
+        if (_deferred)
+            return _clipRect.value_or(Rect<>());
         SDL_Rect cr;
         if (!SDL_GetRenderClipRect(_renderer, &cr))
             Error::Throw("SDL_GetRenderClipRect");
@@ -155,8 +435,29 @@ namespace SDL {
     }
 
     void Renderer::Display() {
+        Flush();
         if (!SDL_RenderPresent(_renderer))
             Error::Throw("SDL_RenderPresent");
+        _frameArena->Reset();
+    }
+
+    FrameArena &Renderer::GetFrameArena() {
+        return *_frameArena;
+    }
+
+    void Renderer::InvalidateState() const {
+        if (_drawColor && _state.drawColor != _drawColor)
+            ApplyDrawColor(*_drawColor);
+        _state = {};
+        _drawColor.reset();
+    }
+
+    const Renderer::StateStats &Renderer::GetStateStats() const {
+        return _stateStats;
+    }
+
+    void Renderer::ResetStateStats() {
+        _stateStats = {};
     }
 
     Properties Renderer::GetProperties() const {
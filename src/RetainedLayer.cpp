@@ -0,0 +1,194 @@
+#include "SDLPP/RetainedLayer.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "SDLPP/Renderer.hpp"
+
+namespace SDL {
+    static Rect<> Union(const Rect<> &a, const Rect<> &b) {
+        const int left = std::min(a.position.x, b.position.x);
+        const int top = std::min(a.position.y, b.position.y);
+        const int right = std::max(a.position.x + a.size.x, b.position.x + b.size.x);
+        const int bottom = std::max(a.position.y + a.size.y, b.position.y + b.size.y);
+        return {left, top, right - left, bottom - top};
+    }
+
+    static long long Area(const Rect<> &rect) {
+        return static_cast<long long>(rect.size.x) * rect.size.y;
+    }
+
+    RetainedLayer::RetainedLayer(const Renderer &renderer, const UVector2 &size, const std::size_t maxRects): _size(size), _maxRects(std::max<std::size_t>(maxRects, 1)) {
+        _texture.Create(renderer, size, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET);
+        InvalidateAll();
+    }
+
+    void RetainedLayer::Add(const Shape &shape) {
+        const FRect bounds = shape.GetBoundingBox();
+        _items.push_back({&shape, &shape, bounds, shape.GetRevision()});
+        AddDirty(bounds);
+    }
+
+    void RetainedLayer::Add(const Drawable &drawable, const FRect &bounds) {
+        _items.push_back({&drawable, nullptr, bounds, 0});
+        AddDirty(bounds);
+    }
+
+    void RetainedLayer::Remove(const Drawable &drawable) {
+        const auto it = std::ranges::find(_items, &drawable, &Item::drawable);
+        if (it == _items.end())
+            return;
+        AddDirty(it->bounds);
+        _items.erase(it);
+    }
+
+    void RetainedLayer::Invalidate(const Drawable &drawable, const FRect &bounds) {
+        const auto it = std::ranges::find(_items, &drawable, &Item::drawable);
+        if (it == _items.end())
+            return;
+        AddDirty(it->bounds);
+        AddDirty(bounds);
+        it->bounds = bounds;
+    }
+
+    void RetainedLayer::Invalidate(const FRect &rect) {
+        AddDirty(rect);
+    }
+
+    void RetainedLayer::InvalidateAll() {
+        _dirty.assign(1, Rect<>(0, 0, static_cast<int>(_size.x), static_cast<int>(_size.y)));
+    }
+
+    void RetainedLayer::SetBackground(const Color &color) {
+        if (_background == color)
+            return;
+        _background = color;
+        InvalidateAll();
+    }
+
+    const Color &RetainedLayer::GetBackground() const {
+        return _background;
+    }
+
+    const Texture &RetainedLayer::GetTexture() const {
+        return _texture;
+    }
+
+    const std::vector<Rect<>> &RetainedLayer::GetDirtyRects() const {
+        return _redrawn;
+    }
+
+    void RetainedLayer::Draw(Renderer &renderer) const {
+        Collect();
+        _redrawn.clear();
+        if (!_dirty.empty()) {
+            Merge();
+            Redraw(renderer);
+            _redrawn.swap(_dirty);
+            _dirty.clear();
+        }
+
+        const FVector2 size(_size);
+        const Vertex vertices[4] = {
+            {{0, 0}, Color::White, {0, 0}},
+            {{size.x, 0}, Color::White, {1, 0}},
+            {size, Color::White, {1, 1}},
+            {{0, size.y}, Color::White, {0, 1}}
+        };
+        static constexpr int indices[6] = {0, 1, 2, 2, 3, 0};
+        renderer.Draw(vertices, indices, _texture);
+    }
+
+    void RetainedLayer::Collect() const {
+        for (Item &item : _items) {
+            if (!item.shape)
+                continue;
+            const FRect bounds = item.shape->GetBoundingBox();
+            const std::size_t revision = item.shape->GetRevision();
+            if (bounds == item.bounds && revision == item.revision)
+                continue;
+            AddDirty(item.bounds);
+            AddDirty(bounds);
+            item.bounds = bounds;
+            item.revision = revision;
+        }
+    }
+
+    void RetainedLayer::Merge() const {
+        for (bool merged = true; merged;) {
+            merged = false;
+            for (std::size_t i = 0; i < _dirty.size() && !merged; ++i) {
+                for (std::size_t j = i + 1; j < _dirty.size() && !merged; ++j) {
+                    const Rect<> combined = Union(_dirty[i], _dirty[j]);
+                    if (_dirty[i].Intersects(_dirty[j]) || Area(combined) <= Area(_dirty[i]) + Area(_dirty[j])) {
+                        _dirty[i] = combined;
+                        _dirty.erase(_dirty.begin() + static_cast<std::ptrdiff_t>(j));
+                        merged = true;
+                    }
+                }
+            }
+        }
+
+        while (_dirty.size() > _maxRects) {
+            std::size_t bestI = 0, bestJ = 1;
+            long long bestGrowth = std::numeric_limits<long long>::max();
+            for (std::size_t i = 0; i < _dirty.size(); ++i) {
+                for (std::size_t j = i + 1; j < _dirty.size(); ++j) {
+                    const long long growth = Area(Union(_dirty[i], _dirty[j])) - Area(_dirty[i]) - Area(_dirty[j]);
+                    if (growth < bestGrowth) {
+                        bestGrowth = growth;
+                        bestI = i;
+                        bestJ = j;
+                    }
+                }
+            }
+            _dirty[bestI] = Union(_dirty[bestI], _dirty[bestJ]);
+            _dirty.erase(_dirty.begin() + static_cast<std::ptrdiff_t>(bestJ));
+        }
+    }
+
+    void RetainedLayer::Redraw(Renderer &renderer) const {
+        Texture previous = renderer.Target();
+        Texture target(_texture.Get(), Borrowed());
+        const SDL_BlendMode blendMode = renderer.GetDrawBlendMode();
+        const Rect<> clipRect = renderer.GetClipRect();
+        renderer.SetTarget(target);
+
+        static constexpr int indices[6] = {0, 1, 2, 2, 3, 0};
+        for (const Rect<> &rect : _dirty) {
+            renderer.SetClipRect(rect);
+            const FRect area(rect);
+            const Vertex background[4] = {
+                {area.position, _background},
+                {area.position + FVector2(area.size.x, 0), _background},
+                {area.position + area.size, _background},
+                {area.position + FVector2(0, area.size.y), _background}
+            };
+            renderer.SetDrawBlendMode(SDL_BLENDMODE_NONE);
+            renderer.Draw(background, indices);
+            renderer.SetDrawBlendMode(blendMode);
+
+            for (const Item &item : _items)
+                if (item.bounds.Intersects(area))
+                    renderer.Draw(*item.drawable);
+        }
+
+        renderer.SetClipRect(std::nullopt);
+        if (previous)
+            renderer.SetTarget(previous);
+        else
+            renderer.SetTarget(nullptr);
+        if (clipRect.size.x > 0 && clipRect.size.y > 0)
+            renderer.SetClipRect(clipRect);
+    }
+
+    void RetainedLayer::AddDirty(const FRect &rect) const {
+        const float left = std::max(SDL_floorf(rect.position.x), 0.0f);
+        const float top = std::max(SDL_floorf(rect.position.y), 0.0f);
+        const float right = std::min(SDL_ceilf(rect.position.x + rect.size.x), static_cast<float>(_size.x));
+        const float bottom = std::min(SDL_ceilf(rect.position.y + rect.size.y), static_cast<float>(_size.y));
+        if (left >= right || top >= bottom)
+            return;
+        _dirty.emplace_back(static_cast<int>(left), static_cast<int>(top), static_cast<int>(right - left), static_cast<int>(bottom - top));
+    }
+}
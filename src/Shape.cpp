@@ -1,12 +1,18 @@
 #include "SDLPP/Shape.hpp"
+#include "SDLPP/CommandList.hpp"
 #include "SDLPP/Renderer.hpp"
 
+#include <mutex>
+#include <unordered_map>
+#include <SDL3/SDL_assert.h>
+
 namespace SDL {
     Shape::Shape()= default;
 
     void Shape::SetColor(const Color &color) {
         _color = color;
-        Recompute();
+        _dirty |= DirtyColor;
+        ++_revision;
     }
 
     const Color &Shape::GetColor() const {
@@ -14,33 +20,83 @@ namespace SDL {
     }
 
     FRect Shape::GetBoundingBox() const {
+        Update();
         return _bounds;
     }
 
+    std::size_t Shape::GetRevision() const {
+        return _revision;
+    }
+
     void Shape::Transform(FVector2 &v) const {
 
     }
 
-    void Shape::Recompute() {
-        _vertices.ClearIndices();
-        _vertices.Resize(GetPointCount() + 1);
+    void Shape::Transform(const std::span<FVector2> points) const {
+        for (FVector2 &point : points)
+            Transform(point);
+    }
+
+    void Shape::InvalidateGeometry() {
+        _dirty |= DirtyGeometry;
+        ++_revision;
+    }
+
+    void Shape::InvalidateTransform() {
+        _dirty |= DirtyTransform;
+        ++_revision;
+    }
+
+    void Shape::InvalidateTranslation(const FVector2 &delta) {
+        ++_revision;
+        if (_dirty & (DirtyGeometry | DirtyTransform))
+            return;
+        _translation += delta;
+        _dirty |= DirtyTranslation;
+    }
+
+    void Shape::Update() const {
+        if (_dirty == DirtyNone)
+            return;
+        if (_dirty & DirtyGeometry)
+            RecomputeOutline();
+        if (_dirty & (DirtyGeometry | DirtyTransform)) {
+            Recompute();
+        } else {
+            if (_dirty & DirtyTranslation)
+                RecomputeTranslation();
+            if (_dirty & DirtyColor)
+                RecomputeColor();
+        }
+        _translation.Clear();
+        _dirty = DirtyNone;
+    }
+
+    void Shape::RecomputeOutline() const {
+        _outline.resize(GetPointCount());
+        for (std::size_t i = 0; i < _outline.size(); ++i)
+            _outline[i] = GetPoint(i);
+        _center = GetCenter();
+        if (!_indices || _indices->size() != _outline.size() * 3)
+            _indices = GetFanIndices(_outline.size());
+    }
+
+    void Shape::Recompute() const {
+        static thread_local std::vector<FVector2> points;
+        points.resize(_outline.size() + 1);
+        points[0] = _center;
+        std::copy(_outline.begin(), _outline.end(), points.begin() + 1);
+        Transform(std::span(points));
 
-        FVector2 center = GetCenter();
-        Transform(center);
-        _vertices.GetVertex(0) = Vertex(center, _color);
+        _vertices.Resize(points.size());
+        const SDL_FColor color = FColor(_color);
 
-        FVector2 minBound = center;
-        FVector2 maxBound = center;
+        FVector2 minBound = points[0];
+        FVector2 maxBound = points[0];
 
-        for (std::size_t i = 0; i < GetPointCount(); ++i) {
-            FVector2 val = GetPoint(i);
-            Transform(val);
-            _vertices.GetVertex(i + 1) = Vertex(val, _color);
-            if (i > 0) {
-                _vertices.Add(0);
-                _vertices.Add(static_cast<int>(i));
-                _vertices.Add(static_cast<int>(i) + 1);
-            }
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            const FVector2 &val = points[i];
+            _vertices.GetVertex(i) = {val, color, {0, 0}};
             if (val.x < minBound.x)
                 minBound.x = val.x;
             if (val.y < minBound.y)
@@ -52,15 +108,56 @@ namespace SDL {
         }
 
         _bounds = {minBound, maxBound - minBound};
+    }
 
-        if (GetPointCount() > 0) {
-            _vertices.Add(0);
-            _vertices.Add(1);
-            _vertices.Add(static_cast<int>(GetPointCount()));
+    void Shape::RecomputeTranslation() const {
+        for (std::size_t i = 0; i < _vertices.VertexCount(); ++i) {
+            SDL_FPoint &position = _vertices.GetVertex(i).position;
+            position.x += _translation.x;
+            position.y += _translation.y;
         }
+        _bounds.position += _translation;
+    }
+
+    void Shape::RecomputeColor() const {
+        const SDL_FColor color = FColor(_color);
+        for (std::size_t i = 0; i < _vertices.VertexCount(); ++i)
+            _vertices.GetVertex(i).color = color;
     }
 
     void Shape::Draw(Renderer &renderer) const {
-        renderer.Draw(_vertices);
+        Update();
+        if (_indices->empty())
+            return;
+        renderer.Draw(_vertices.Vertices(), static_cast<int>(_vertices.VertexCount()), _indices->data(), static_cast<int>(_indices->size()));
+    }
+
+    void Shape::Record(CommandList &list) const {
+        SDL_assert(_dirty == DirtyNone);
+        Update();
+        if (_indices->empty())
+            return;
+        list.Draw(_vertices.Vertices(), static_cast<int>(_vertices.VertexCount()), _indices->data(), static_cast<int>(_indices->size()));
+    }
+
+    std::shared_ptr<const std::vector<int>> Shape::GetFanIndices(const std::size_t points) {
+        static std::mutex mutex;
+        static std::unordered_map<std::size_t, std::weak_ptr<const std::vector<int>>> cache;
+
+        const std::lock_guard lock(mutex);
+        if (const auto it = cache.find(points); it != cache.end())
+            if (auto indices = it->second.lock())
+                return indices;
+        std::erase_if(cache, [](const auto &entry) { return entry.second.expired(); });
+
+        auto indices = std::make_shared<std::vector<int>>();
+        if (points > 0) {
+            indices->reserve(points * 3);
+            for (std::size_t i = 1; i < points; ++i)
+                indices->insert(indices->end(), {0, static_cast<int>(i), static_cast<int>(i) + 1});
+            indices->insert(indices->end(), {0, 1, static_cast<int>(points)});
+        }
+        cache[points] = indices;
+        return indices;
     }
 }
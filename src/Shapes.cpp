@@ -1,15 +1,18 @@
 #include "SDLPP/Shapes.hpp"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace SDL::Shapes {
     Rectangle::Rectangle() = default;
 
     Rectangle::Rectangle(const FVector2 &size): _size(size) {
-        Recompute();
+
     }
 
     void Rectangle::SetSize(const FVector2 &size) {
         _size = size;
-        Recompute();
+        InvalidateGeometry();
     }
 
     const FVector2 &Rectangle::GetSize() const {
@@ -39,15 +42,19 @@ namespace SDL::Shapes {
         return 4;
     }
 
-    Circle::Circle()= default;
+    Circle::Circle(): _unitCircle(GetUnitCircle(_points)) {
+
+    }
+
+    Circle::Circle(const float radius, const unsigned int points): _radius(radius), _points(points), _unitCircle(GetUnitCircle(points)) {
 
-    Circle::Circle(const float radius, const unsigned int points): _radius(radius), _points(points) {
-        Recompute();
     }
 
     void Circle::SetRadius(const float radius) {
+        if (radius == _radius)
+            return;
         _radius = radius;
-        Recompute();
+        InvalidateGeometry();
     }
 
     float Circle::GetRadius() const {
@@ -55,8 +62,11 @@ namespace SDL::Shapes {
     }
 
     void Circle::SetPoints(const unsigned int points) {
+        if (points == _points)
+            return;
         _points = points;
-        Recompute();
+        _unitCircle = GetUnitCircle(points);
+        InvalidateGeometry();
     }
 
     unsigned int Circle::GetPoints() const {
@@ -68,11 +78,29 @@ namespace SDL::Shapes {
     }
 
     FVector2 Circle::GetPoint(const std::size_t i) const {
-        const float a = static_cast<float>(i) / static_cast<float>(_points) * std::numbers::pi_v<float> * 2;
-        return FVector2(std::cos(a) * _radius, std::sin(a) * _radius) + FVector2(_radius, _radius);
+        return (*_unitCircle)[i] * _radius + FVector2(_radius, _radius);
     }
 
     std::size_t Circle::GetPointCount() const {
         return _points;
     }
+
+    std::shared_ptr<const std::vector<FVector2>> Circle::GetUnitCircle(const unsigned int points) {
+        static std::mutex mutex;
+        static std::unordered_map<unsigned int, std::weak_ptr<const std::vector<FVector2>>> cache;
+
+        const std::lock_guard lock(mutex);
+        if (const auto it = cache.find(points); it != cache.end())
+            if (auto table = it->second.lock())
+                return table;
+        std::erase_if(cache, [](const auto &entry) { return entry.second.expired(); });
+
+        auto table = std::make_shared<std::vector<FVector2>>(points);
+        for (unsigned int i = 0; i < points; ++i) {
+            const float a = static_cast<float>(i) / static_cast<float>(points) * std::numbers::pi_v<float> * 2;
+            (*table)[i] = {std::cos(a), std::sin(a)};
+        }
+        cache[points] = table;
+        return table;
+    }
 }
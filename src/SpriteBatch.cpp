@@ -0,0 +1,80 @@
+#include "SDLPP/SpriteBatch.hpp"
+#include "SDLPP/Error.hpp"
+
+namespace SDL {
+    SpriteBatch::SpriteBatch() = default;
+
+    void SpriteBatch::Add(SDL_Renderer *renderer, const SDL_Vertex *vertices, const int vertexCount, const int *indices,
+        const int indexCount, SDL_Texture *texture) {
+        if (vertexCount <= 0)
+            return;
+
+        SDL_BlendMode blendMode = SDL_BLENDMODE_INVALID;
+        if (texture ? !SDL_GetTextureBlendMode(texture, &blendMode) : !SDL_GetRenderDrawBlendMode(renderer, &blendMode))
+            Error::Throw(texture ? "SDL_GetTextureBlendMode" : "SDL_GetRenderDrawBlendMode");
+
+        if (!Empty() && (texture != _texture || blendMode != _blendMode))
+            Flush(renderer);
+        _texture = texture;
+        _blendMode = blendMode;
+
+        const int base = static_cast<int>(_vertices.size());
+        _vertices.insert(_vertices.end(), vertices, vertices + vertexCount);
+        if (indices) {
+            _indices.reserve(_indices.size() + indexCount);
+            for (int i = 0; i < indexCount; ++i)
+                _indices.push_back(indices[i] + base);
+        } else {
+            _indices.reserve(_indices.size() + vertexCount);
+            for (int i = 0; i < vertexCount; ++i)
+                _indices.push_back(base + i);
+        }
+        ++_draws;
+    }
+
+    void SpriteBatch::Flush(SDL_Renderer *renderer) {
+        if (Empty())
+            return;
+        const bool result = SDL_RenderGeometry(renderer, _texture, _vertices.data(), static_cast<int>(_vertices.size()), _indices.data(), static_cast<int>(_indices.size()));
+        Clear();
+        ++_flushes;
+        if (!result)
+            Error::Throw("SDL_RenderGeometry");
+    }
+
+    void SpriteBatch::Clear() {
+        _vertices.clear();
+        _indices.clear();
+        _texture = nullptr;
+        _blendMode = SDL_BLENDMODE_INVALID;
+    }
+
+    bool SpriteBatch::Empty() const {
+        return _vertices.empty();
+    }
+
+    std::size_t SpriteBatch::VertexCount() const {
+        return _vertices.size();
+    }
+
+    std::size_t SpriteBatch::IndexCount() const {
+        return _indices.size();
+    }
+
+    std::size_t SpriteBatch::GetDrawCount() const {
+        return _draws;
+    }
+
+    std::size_t SpriteBatch::GetFlushCount() const {
+        return _flushes;
+    }
+
+    std::size_t SpriteBatch::GetSavedCalls() const {
+        return _draws > _flushes ? _draws - _flushes : 0;
+    }
+
+    void SpriteBatch::ResetStats() {
+        _draws = 0;
+        _flushes = 0;
+    }
+}
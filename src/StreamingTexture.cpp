@@ -0,0 +1,63 @@
+#include "SDLPP/StreamingTexture.hpp"
+
+#include <algorithm>
+
+#include "SDLPP/Error.hpp"
+#include "SDLPP/Renderer.hpp"
+
+namespace SDL {
+    StreamingTexture::StreamingTexture(const Renderer &renderer, const UVector2 &size, const SDL_PixelFormat format,
+        const std::size_t bufferCount): _textures(std::max<std::size_t>(bufferCount, 2)), _size(size) {
+        if (bufferCount < 2)
+            Error::Throw("SDL::StreamingTexture::StreamingTexture", "At least two buffers are required");
+        for (Texture &texture : _textures)
+            texture.Create(renderer, size, format, SDL_TEXTUREACCESS_STREAMING);
+    }
+
+    Texture::LockedPixels StreamingTexture::Lock() {
+        if (_locked)
+            Error::Throw("SDL::StreamingTexture::Lock", "Texture is already locked");
+        Texture::LockedPixels pixels = _textures[GetBackIndex()].Lock();
+        if (pixels.pixels.data() == nullptr)
+            return pixels;
+        _locked = true;
+        return pixels;
+    }
+
+    void StreamingTexture::Unlock() {
+        if (!_locked)
+            return;
+        const std::size_t back = GetBackIndex();
+        _textures[back].Unlock();
+        _front = back;
+        _locked = false;
+    }
+
+    void StreamingTexture::Update(const void *pixels, const int pitch) {
+        if (_locked)
+            Error::Throw("SDL::StreamingTexture::Update", "Texture is locked");
+        const std::size_t back = GetBackIndex();
+        _textures[back].Update(Rect<>(0, 0, static_cast<int>(_size.x), static_cast<int>(_size.y)), pixels, pitch);
+        _front = back;
+    }
+
+    const Texture &StreamingTexture::GetTexture() const {
+        return _textures[_front];
+    }
+
+    std::size_t StreamingTexture::GetBufferCount() const {
+        return _textures.size();
+    }
+
+    const UVector2 &StreamingTexture::GetSize() const {
+        return _size;
+    }
+
+    bool StreamingTexture::IsLocked() const {
+        return _locked;
+    }
+
+    std::size_t StreamingTexture::GetBackIndex() const {
+        return (_front + 1) % _textures.size();
+    }
+}
@@ -1,6 +1,135 @@
 #include "SDLPP/Surface.hpp"
 
+#include "SDL3_image/SDL_image.h"
+
+#include <numeric>
+
+#include "PixelKernels.hpp"
+#include "SDLPP/ThreadPool.hpp"
+
 namespace SDL {
+    static constexpr int BandBytes = 256 * 1024;
+
+    static bool HasDirectPixels(const SDL_Surface *surface) {
+        return surface != nullptr && surface->pixels != nullptr && !SDL_MUSTLOCK(surface) &&
+            !SDL_ISPIXELFORMAT_FOURCC(surface->format) && SDL_BYTESPERPIXEL(surface->format) == 4;
+    }
+
+    static const SDL_PixelFormatDetails *Get8888Details(const SDL_Surface *surface) {
+        if (!HasDirectPixels(surface))
+            return nullptr;
+        const SDL_PixelFormatDetails *details = SDL_GetPixelFormatDetails(surface->format);
+        if (details == nullptr || details->Rbits != 8 || details->Gbits != 8 || details->Bbits != 8 || (details->Abits != 0 && details->Abits != 8))
+            return nullptr;
+        return details;
+    }
+
+    static bool CanSplitBlit(const SDL_Surface *src, const SDL_Surface *dst) {
+        constexpr SDL_SurfaceFlags unsafe = SDL_SURFACE_LOCK_NEEDED | SDL_SURFACE_LOCKED;
+        if (src == nullptr || dst == nullptr || src->pixels == nullptr || dst->pixels == nullptr ||
+            (src->flags & unsafe) != 0 || (dst->flags & unsafe) != 0)
+            return false;
+        const auto *srcPixels = static_cast<const Uint8 *>(src->pixels), *dstPixels = static_cast<const Uint8 *>(dst->pixels);
+        return srcPixels >= dstPixels + static_cast<std::ptrdiff_t>(dst->pitch) * dst->h ||
+            dstPixels >= srcPixels + static_cast<std::ptrdiff_t>(src->pitch) * src->h;
+    }
+
+    static bool Contains(const SDL_Rect &outer, const SDL_Rect &inner) {
+        return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.w <= outer.x + outer.w && inner.y + inner.h <= outer.y + outer.h;
+    }
+
+    static int GetBandRows(const SDL_Surface *dst, const int width) {
+        return std::max(BandBytes / std::max(width * SDL_BYTESPERPIXEL(dst->format), 1), 1);
+    }
+
+    static bool IsPlainStretch(SDL_Surface *src, const SDL_Surface *dst) {
+        Uint8 r = 0, g = 0, b = 0, a = 0;
+        SDL_BlendMode blendMode = SDL_BLENDMODE_INVALID;
+        SDL_GetSurfaceColorMod(src, &r, &g, &b);
+        SDL_GetSurfaceAlphaMod(src, &a);
+        SDL_GetSurfaceBlendMode(src, &blendMode);
+        return src->format == dst->format && SDL_BYTESPERPIXEL(src->format) == 4 && src->format != SDL_PIXELFORMAT_ARGB2101010 &&
+            r == 255 && g == 255 && b == 255 && a == 255 && blendMode == SDL_BLENDMODE_NONE && !SDL_SurfaceHasColorKey(src);
+    }
+
+    static int GetScaledBandRows(const SDL_Surface *dst, const SDL_Rect &srcRect, const SDL_Rect &dstRect, const SDL_ScaleMode scaleMode) {
+        const int rows = GetBandRows(dst, dstRect.w);
+        if (scaleMode != SDL_SCALEMODE_NEAREST)
+            return srcRect.h == dstRect.h ? rows : 0;
+        const Uint64 step = (static_cast<Uint64>(srcRect.h) << 16) / dstRect.h;
+        const Uint64 remainder = (static_cast<Uint64>(srcRect.h) << 16) - step * dstRect.h;
+        const Uint64 period = 65536 / std::gcd(step, Uint64(65536));
+        const Uint64 bandRows = (rows + period - 1) / period * period;
+        if (bandRows >= static_cast<Uint64>(dstRect.h) || remainder >= bandRows)
+            return 0;
+        return static_cast<int>(bandRows);
+    }
+
+    static SDL_Rect GetScaledBandSource(const SDL_Rect &srcRect, const SDL_Rect &dstRect, const int y, const int h) {
+        const Uint64 step = (static_cast<Uint64>(srcRect.h) << 16) / dstRect.h;
+        const int top = static_cast<int>(step * y >> 16);
+        const int bottom = y + h == dstRect.h ? srcRect.h : static_cast<int>(step * (y + h) >> 16);
+        return {srcRect.x, srcRect.y + top, srcRect.w, bottom - top};
+    }
+
+    static SDL_Surface *CreateBlitView(SDL_Surface *surface) {
+        SDL_Surface *view = SDL_CreateSurfaceFrom(surface->w, surface->h, surface->format, surface->pixels, surface->pitch);
+        if (view == nullptr) {
+            Error::Throw("SDL_CreateSurfaceFrom");
+            return nullptr;
+        }
+        Uint8 r = 255, g = 255, b = 255, a = 255;
+        SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+        Uint32 colorKey = 0;
+        SDL_GetSurfaceColorMod(surface, &r, &g, &b);
+        SDL_GetSurfaceAlphaMod(surface, &a);
+        SDL_GetSurfaceBlendMode(surface, &blendMode);
+        SDL_SetSurfaceColorMod(view, r, g, b);
+        SDL_SetSurfaceAlphaMod(view, a);
+        SDL_SetSurfaceBlendMode(view, blendMode);
+        if (SDL_GetSurfaceColorKey(surface, &colorKey))
+            SDL_SetSurfaceColorKey(view, true, colorKey);
+        if (SDL_Palette *palette = SDL_GetSurfacePalette(surface))
+            SDL_SetSurfacePalette(view, palette);
+        SDL_SetSurfaceColorspace(view, SDL_GetSurfaceColorspace(surface));
+        SDL_CopyProperties(SDL_GetSurfaceProperties(surface), SDL_GetSurfaceProperties(view));
+        return view;
+    }
+
+    template<typename BlitBand>
+    static bool BlitBands(ThreadPool &pool, SDL_Surface *src, const int height, const int bandRows, BlitBand blit) {
+        const int bands = std::max(height / bandRows, 1);
+        if (bands == 1) {
+            blit(src, 0, height);
+            return true;
+        }
+        const std::size_t participants = std::min<std::size_t>(bands, pool.GetThreadCount() + 1);
+        std::vector<Surface> views;
+        views.reserve(participants);
+        for (std::size_t i = 0; i < participants; ++i) {
+            SDL_Surface *view = CreateBlitView(src);
+            if (view == nullptr)
+                return false;
+            views.emplace_back(view);
+        }
+        pool.ParallelFor(bands, [&](const std::size_t i, const std::size_t slot) {
+            const int y = static_cast<int>(i) * bandRows;
+            blit(views[slot].Get(), y, static_cast<int>(i) == bands - 1 ? height - y : bandRows);
+        });
+        return true;
+    }
+
+    template<typename Kernel>
+    static void ForEachRow(const SDL_Surface *surface, const SDL_Rect &rect, Kernel kernel) {
+        auto *row = static_cast<Uint8 *>(surface->pixels) + static_cast<std::ptrdiff_t>(rect.y) * surface->pitch + rect.x * 4;
+        if (rect.x == 0 && rect.w * 4 == surface->pitch) {
+            kernel(reinterpret_cast<Uint32 *>(row), static_cast<std::size_t>(rect.w) * rect.h);
+            return;
+        }
+        for (int y = 0; y < rect.h; ++y, row += surface->pitch)
+            kernel(reinterpret_cast<Uint32 *>(row), static_cast<std::size_t>(rect.w));
+    }
+
     Surface::Surface() = default;
 
     Surface::Surface(SDL_Surface *surface): _surface(surface) {
@@ -29,8 +158,22 @@ namespace SDL {
         return *this;
     }
 
+    void Surface::LoadFile(const std::string &file) {
+        _surface = IMG_Load(file.c_str());
+        if (_surface == nullptr)
+            Error::Throw("IMG_Load");
+    }
+
     void Surface::Clear(const Color &color) {
-        if (!SDL_ClearSurface(_surface, color.r, color.g, color.b, color.a))
+        if (HasDirectPixels(_surface) && SDL_GetSurfaceColorspace(_surface) == SDL_COLORSPACE_SRGB) {
+            const Uint32 pixel = MapRGBA(color);
+            const PixelKernels::FillKernel fill = PixelKernels::GetFill(static_cast<std::size_t>(_surface->w) * _surface->h);
+            ForEachRow(_surface, {0, 0, _surface->w, _surface->h}, [fill, pixel](Uint32 *row, const std::size_t count) {
+                fill(row, count, pixel);
+            });
+            return;
+        }
+        if (!SDL_ClearSurface(_surface, color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f))
             Error::Throw("SDL_ClearSurface");
     }
 
@@ -41,6 +184,51 @@ namespace SDL {
 
     }
 
+    void Surface::Blit(const std::optional<Rect<>> &srcRect, Surface &dst, const std::optional<Rect<>> &dstRect,
+        ThreadPool &pool) {
+        if (!CanSplitBlit(_surface, dst)) {
+            Blit(srcRect, dst, dstRect);
+            return;
+        }
+        SDL_Rect sdl_src = srcRect.value_or(SDL_Rect{0, 0, _surface->w, _surface->h});
+        SDL_Point position = dstRect ? SDL_Point{dstRect->position.x, dstRect->position.y} : SDL_Point{0, 0};
+        if (sdl_src.x < 0) {
+            sdl_src.w += sdl_src.x;
+            position.x -= sdl_src.x;
+            sdl_src.x = 0;
+        }
+        if (sdl_src.y < 0) {
+            sdl_src.h += sdl_src.y;
+            position.y -= sdl_src.y;
+            sdl_src.y = 0;
+        }
+        sdl_src.w = std::min(sdl_src.w, _surface->w - sdl_src.x);
+        sdl_src.h = std::min(sdl_src.h, _surface->h - sdl_src.y);
+        SDL_Rect clip;
+        SDL_GetSurfaceClipRect(dst, &clip);
+        if (const int dx = clip.x - position.x; dx > 0) {
+            sdl_src.w -= dx;
+            sdl_src.x += dx;
+            position.x += dx;
+        }
+        if (const int dy = clip.y - position.y; dy > 0) {
+            sdl_src.h -= dy;
+            sdl_src.y += dy;
+            position.y += dy;
+        }
+        sdl_src.w = std::min(sdl_src.w, clip.x + clip.w - position.x);
+        sdl_src.h = std::min(sdl_src.h, clip.y + clip.h - position.y);
+        if (sdl_src.w <= 0 || sdl_src.h <= 0)
+            return;
+        const bool split = BlitBands(pool, _surface, sdl_src.h, GetBandRows(dst, sdl_src.w), [&](SDL_Surface *view, const int y, const int h) {
+            const SDL_Rect band_src{sdl_src.x, sdl_src.y + y, sdl_src.w, h}, band_dst{position.x, position.y + y, sdl_src.w, h};
+            if (!SDL_BlitSurfaceUnchecked(view, &band_src, dst, &band_dst))
+                Error::Throw("SDL_BlitSurfaceUnchecked");
+        });
+        if (!split)
+            Blit(srcRect, dst, dstRect);
+    }
+
     void Surface::Blit9Grid(const std::optional<Rect<>> &srcRect, const int leftWidth, const int rightWidth,
         const int topHeight, const int bottomHeight, const float scale, const SDL_ScaleMode scaleMode, Surface &dst,
         const std::optional<Rect<>> &dstRect) {
@@ -57,6 +245,34 @@ namespace SDL {
             Error::Throw("SDL_BlitSurfaceScaled");
     }
 
+    void Surface::BlitScaled(const std::optional<Rect<>> &srcRect, Surface &dst, const std::optional<Rect<>> &dstRect,
+        const SDL_ScaleMode scaleMode, ThreadPool &pool) {
+        if (!CanSplitBlit(_surface, dst) || SDL_BITSPERPIXEL(_surface->format) < 8) {
+            BlitScaled(srcRect, dst, dstRect, scaleMode);
+            return;
+        }
+        const SDL_Rect sdl_src = srcRect.value_or(SDL_Rect{0, 0, _surface->w, _surface->h});
+        const SDL_Rect sdl_dst = dstRect.value_or(SDL_Rect{0, 0, dst.Get()->w, dst.Get()->h});
+        if (sdl_src.w == sdl_dst.w && sdl_src.h == sdl_dst.h) {
+            Blit(srcRect, dst, dstRect, pool);
+            return;
+        }
+        SDL_Rect clip;
+        SDL_GetSurfaceClipRect(dst, &clip);
+        const int bandRows = scaleMode == SDL_SCALEMODE_NEAREST || IsPlainStretch(_surface, dst) ? GetScaledBandRows(dst, sdl_src, sdl_dst, scaleMode) : 0;
+        if (bandRows == 0 || sdl_src.w <= 0 || sdl_src.h <= 0 || !Contains({0, 0, _surface->w, _surface->h}, sdl_src) || !Contains(clip, sdl_dst)) {
+            BlitScaled(srcRect, dst, dstRect, scaleMode);
+            return;
+        }
+        const bool split = BlitBands(pool, _surface, sdl_dst.h, bandRows, [&](SDL_Surface *view, const int y, const int h) {
+            const SDL_Rect band_src = GetScaledBandSource(sdl_src, sdl_dst, y, h), band_dst{sdl_dst.x, sdl_dst.y + y, sdl_dst.w, h};
+            if (!SDL_BlitSurfaceUncheckedScaled(view, &band_src, dst, &band_dst, scaleMode))
+                Error::Throw("SDL_BlitSurfaceUncheckedScaled");
+        });
+        if (!split)
+            BlitScaled(srcRect, dst, dstRect, scaleMode);
+    }
+
     void Surface::BlitTiled(const std::optional<Rect<>> &srcRect, Surface &dst, const std::optional<Rect<>> &dstRect) {
         const SDL_Rect sdl_src = srcRect.value_or(SDL_Rect()), sdl_dst = dstRect.value_or(SDL_Rect());
         if (!SDL_BlitSurfaceTiled(_surface, srcRect ? &sdl_src : nullptr, dst, dstRect ? &sdl_dst : nullptr))
@@ -96,14 +312,14 @@ namespace SDL {
         return {_surface->w, _surface->h};
     }
 
-    Surface Surface::Convert(const SDL_PixelFormat format) {
+    Surface Surface::Convert(const SDL_PixelFormat format) const {
         SDL_Surface *surface = SDL_ConvertSurface(_surface, format);
         if (surface == nullptr)
             Error::Throw("SDL_ConvertSurface");
         return surface;
     }
 
-    Surface Surface::Duplicate() {
+    Surface Surface::Duplicate() const {
         SDL_Surface *surface = SDL_DuplicateSurface(_surface);
         if (surface == nullptr)
             Error::Throw("SDL_DuplicateSurface");
@@ -123,11 +339,27 @@ namespace SDL {
 
     void Surface::FillRect(const Rect<> rect, const Uint32 color) {
         const SDL_Rect sdl_rect = rect;
+        if (HasDirectPixels(_surface)) {
+            SDL_Rect clip, clipped;
+            SDL_GetSurfaceClipRect(_surface, &clip);
+            if (SDL_GetRectIntersection(&sdl_rect, &clip, &clipped)) {
+                const PixelKernels::FillKernel fill = PixelKernels::GetFill(static_cast<std::size_t>(clipped.w) * clipped.h);
+                ForEachRow(_surface, clipped, [fill, color](Uint32 *row, const std::size_t count) {
+                    fill(row, count, color);
+                });
+            }
+            return;
+        }
         if (!SDL_FillSurfaceRect(_surface, &sdl_rect, color))
             Error::Throw("SDL_FillSurfaceRect");
     }
 
     void Surface::FillRects(const Rect<> rects[], const std::size_t rectCount, const Uint32 color) {
+        if (HasDirectPixels(_surface)) {
+            for (std::size_t i = 0; i < rectCount; ++i)
+                FillRect(rects[i], color);
+            return;
+        }
         std::vector<SDL_Rect> sdl_rects(rectCount);
         std::transform(rects, rects + rectCount, sdl_rects.begin(), [](const SDL_Rect &rect) {
             return SDL_Rect(rect);
@@ -153,6 +385,23 @@ namespace SDL {
         return alphaMod;
     }
 
+    void Surface::BakeAlphaMod() {
+        const SDL_PixelFormatDetails *details = Get8888Details(_surface);
+        if (details == nullptr || details->Abits != 8) {
+            Error::Throw("SDL::Surface::BakeAlphaMod", "Unsupported pixel format");
+            return;
+        }
+        const Uint8 alphaMod = GetAlphaMod();
+        if (alphaMod == 255)
+            return;
+        const Uint32 factors = ~details->Amask | static_cast<Uint32>(alphaMod) << details->Ashift;
+        const PixelKernels::ModulateKernel modulate = PixelKernels::GetModulate();
+        ForEachRow(_surface, {0, 0, _surface->w, _surface->h}, [modulate, factors](Uint32 *row, const std::size_t count) {
+            modulate(row, count, factors);
+        });
+        SetAlphaMod(255);
+    }
+
     void Surface::SetBlendMode(const SDL_BlendMode blendMode) {
         if (!SDL_SetSurfaceBlendMode(_surface, blendMode))
             Error::Throw("SDL_SetSurfaceBlendMode");
@@ -202,6 +451,25 @@ namespace SDL {
         return colorMod;
     }
 
+    void Surface::BakeColorMod() {
+        const SDL_PixelFormatDetails *details = Get8888Details(_surface);
+        if (details == nullptr) {
+            Error::Throw("SDL::Surface::BakeColorMod", "Unsupported pixel format");
+            return;
+        }
+        const Color colorMod = GetColorMod();
+        if (colorMod.r == 255 && colorMod.g == 255 && colorMod.b == 255)
+            return;
+        const Uint32 factors = ~(details->Rmask | details->Gmask | details->Bmask) |
+            static_cast<Uint32>(colorMod.r) << details->Rshift | static_cast<Uint32>(colorMod.g) << details->Gshift |
+            static_cast<Uint32>(colorMod.b) << details->Bshift;
+        const PixelKernels::ModulateKernel modulate = PixelKernels::GetModulate();
+        ForEachRow(_surface, {0, 0, _surface->w, _surface->h}, [modulate, factors](Uint32 *row, const std::size_t count) {
+            modulate(row, count, factors);
+        });
+        SetColorMod(Color::White);
+    }
+
     void Surface::SetColorspace(const SDL_Colorspace colorspace) {
         if (!SDL_SetSurfaceColorspace(_surface, colorspace))
             Error::Throw("SDL_SetSurfaceColorspace");
@@ -242,16 +510,59 @@ namespace SDL {
     }
 
     void Surface::PremultiplyAlpha(const bool linear) {
+        const SDL_PixelFormatDetails *details = Get8888Details(_surface);
+        if (!linear && details != nullptr && details->Abits == 8) {
+            const PixelKernels::AlphaKernel premultiply = PixelKernels::GetPremultiply();
+            ForEachRow(_surface, {0, 0, _surface->w, _surface->h}, [premultiply, details](Uint32 *row, const std::size_t count) {
+                premultiply(row, count, details->Ashift);
+            });
+            return;
+        }
         if (!SDL_PremultiplySurfaceAlpha(_surface, linear))
             Error::Throw("SDL_PremultiplySurfaceAlpha");
     }
 
+    void Surface::UnpremultiplyAlpha() {
+        const SDL_PixelFormatDetails *details = Get8888Details(_surface);
+        if (details == nullptr || details->Abits != 8) {
+            Error::Throw("SDL::Surface::UnpremultiplyAlpha", "Unsupported pixel format");
+            return;
+        }
+        const PixelKernels::AlphaKernel unpremultiply = PixelKernels::GetUnpremultiply();
+        ForEachRow(_surface, {0, 0, _surface->w, _surface->h}, [unpremultiply, details](Uint32 *row, const std::size_t count) {
+            unpremultiply(row, count, details->Ashift);
+        });
+    }
+
     void Surface::Stretch(const Rect<> srcRect, Surface &dst, const Rect<> dstRect, const SDL_ScaleMode scaleMode) {
         const SDL_Rect sdl_src = srcRect, dst_src = dstRect;
         if (!SDL_StretchSurface(_surface, &sdl_src, dst, &dst_src, scaleMode))
             Error::Throw("SDL_StretchSurface");
     }
 
+    void Surface::Stretch(const Rect<> srcRect, Surface &dst, const Rect<> dstRect, const SDL_ScaleMode scaleMode,
+        ThreadPool &pool) {
+        const SDL_Rect sdl_src = srcRect, sdl_dst = dstRect;
+        if (!CanSplitBlit(_surface, dst) || _surface->format != dst.Get()->format || SDL_ISPIXELFORMAT_FOURCC(_surface->format) ||
+            sdl_src.w <= 0 || sdl_src.h <= 0 || sdl_dst.w <= 0 || sdl_dst.h <= 0 ||
+            !Contains({0, 0, _surface->w, _surface->h}, sdl_src) || !Contains({0, 0, dst.Get()->w, dst.Get()->h}, sdl_dst)) {
+            Stretch(srcRect, dst, dstRect, scaleMode);
+            return;
+        }
+        const int bandRows = GetScaledBandRows(dst, sdl_src, sdl_dst, scaleMode);
+        if (bandRows == 0) {
+            Stretch(srcRect, dst, dstRect, scaleMode);
+            return;
+        }
+        const bool split = BlitBands(pool, _surface, sdl_dst.h, bandRows, [&](SDL_Surface *view, const int y, const int h) {
+            const SDL_Rect band_src = GetScaledBandSource(sdl_src, sdl_dst, y, h), band_dst{sdl_dst.x, sdl_dst.y + y, sdl_dst.w, h};
+            if (!SDL_StretchSurface(view, &band_src, dst, &band_dst, scaleMode))
+                Error::Throw("SDL_StretchSurface");
+        });
+        if (!split)
+            Stretch(srcRect, dst, dstRect, scaleMode);
+    }
+
     bool Surface::HasColorKey() const {
         return SDL_SurfaceHasColorKey(_surface);
     }
@@ -274,8 +585,5 @@ namespace SDL {
         return _surface;
     }
 
-    Surface::~Surface() {
-        if (_surface != nullptr)
-            SDL_DestroySurface(_surface);
-    }
+    Surface::~Surface() = default;
 }
@@ -0,0 +1,147 @@
+#include "SDLPP/Text.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "SDLPP/Renderer.hpp"
+
+namespace SDL {
+    Text::Text() = default;
+
+    Text::Text(const Font &font, const std::string &string): _font(&font), _string(string) {
+
+    }
+
+    void Text::SetFont(const Font &font) {
+        if (_font == &font)
+            return;
+        _font = &font;
+        _layoutDirty = true;
+    }
+
+    const Font *Text::GetFont() const {
+        return _font;
+    }
+
+    void Text::SetString(const std::string &string) {
+        if (_string == string)
+            return;
+        _string = string;
+        _layoutDirty = true;
+    }
+
+    const std::string &Text::GetString() const {
+        return _string;
+    }
+
+    void Text::SetColor(const Color &color) {
+        if (_color == color)
+            return;
+        _color = color;
+        _colorDirty = true;
+    }
+
+    const Color &Text::GetColor() const {
+        return _color;
+    }
+
+    void Text::SetPosition(const FVector2 &position) {
+        _position = position;
+    }
+
+    const FVector2 &Text::GetPosition() const {
+        return _position;
+    }
+
+    FRect Text::GetBounds() const {
+        Update();
+        return _bounds;
+    }
+
+    void Text::Draw(Renderer &renderer) const {
+        Update();
+        for (std::size_t page = 0; page < _pages.size(); ++page)
+            if (_pages[page].VertexCount() > 0)
+                renderer.Draw(_pages[page], _font->GetAtlas().GetTexture(page));
+    }
+
+    void Text::Update() const {
+        if (_layoutDirty) {
+            Layout();
+            return;
+        }
+        if (_colorDirty) {
+            const SDL_FColor color = FColor(_color);
+            for (VertexBuffer &page : _pages)
+                for (std::size_t i = 0; i < page.VertexCount(); ++i)
+                    page.GetVertex(i).color = color;
+            _colorDirty = false;
+        }
+        if (_origin != _position) {
+            for (std::size_t page = 0; page < _pages.size(); ++page)
+                for (std::size_t i = 0; i < _offsets[page].size(); ++i)
+                    _pages[page].GetVertex(i).position = _position + _offsets[page][i];
+            _bounds.position = _position;
+            _origin = _position;
+        }
+    }
+
+    void Text::Layout() const {
+        for (VertexBuffer &page : _pages)
+            page.Clear();
+        for (std::vector<FVector2> &offsets : _offsets)
+            offsets.clear();
+        _bounds = {_position, {0, 0}};
+        _origin = _position;
+        _layoutDirty = false;
+        _colorDirty = false;
+        if (!_font)
+            return;
+        _pages.resize(_font->GetAtlas().PageCount());
+        _offsets.resize(_pages.size());
+
+        static constexpr int quad[6] = {0, 1, 2, 2, 3, 0};
+        const Color color = _color;
+        FVector2 pen;
+        FVector2 max;
+        Uint32 previous = 0;
+        const char *text = _string.c_str();
+        std::size_t length = _string.size();
+        while (length > 0) {
+            const Uint32 codepoint = SDL_StepUTF8(&text, &length);
+            if (codepoint == '\n') {
+                pen = {0, pen.y + _font->GetLineHeight()};
+                previous = 0;
+                continue;
+            }
+            const Font::Glyph *glyph = _font->GetGlyph(codepoint);
+            if (!glyph)
+                glyph = _font->GetGlyph('?');
+            if (!glyph)
+                continue;
+            pen.x += _font->GetKerning(previous, codepoint);
+            previous = codepoint;
+
+            const FVector2 offset = pen + glyph->offset;
+            const FVector2 size(glyph->region.rect.size);
+            if (size.x > 0 && size.y > 0) {
+                const FRect &uv = glyph->region.uv;
+                VertexBuffer &page = _pages[glyph->region.page];
+                const FVector2 corners[4] = {offset, offset + FVector2(size.x, 0), offset + size, offset + FVector2(0, size.y)};
+                const int base = static_cast<int>(page.VertexCount());
+                const std::span<Vertex> vertices = page.Map(4);
+                vertices[0] = {_position + corners[0], color, uv.position};
+                vertices[1] = {_position + corners[1], color, uv.position + FVector2(uv.size.x, 0)};
+                vertices[2] = {_position + corners[2], color, uv.position + uv.size};
+                vertices[3] = {_position + corners[3], color, uv.position + FVector2(0, uv.size.y)};
+                page.Append(quad, base);
+                _offsets[glyph->region.page].insert(_offsets[glyph->region.page].end(), std::begin(corners), std::end(corners));
+            }
+            pen.x += glyph->advance;
+            max = {std::max(max.x, pen.x), std::max(max.y, pen.y + _font->GetLineHeight())};
+        }
+        _bounds.size = max;
+        for (VertexBuffer &page : _pages)
+            page.Finalize();
+    }
+}
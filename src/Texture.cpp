@@ -5,6 +5,10 @@
 #include "SDL3_image/SDL_image.h"
 
 namespace SDL {
+    std::span<std::byte> Texture::LockedPixels::Row(const int y) const {
+        return pixels.subspan(static_cast<std::size_t>(y) * pitch, static_cast<std::size_t>(size.x) * SDL_BYTESPERPIXEL(format));
+    }
+
     Texture::Texture() = default;
 
     Texture::Texture(Texture &&texture) noexcept: _texture(std::move(texture._texture)) {
@@ -24,17 +28,15 @@ namespace SDL {
     }
 
     void Texture::Create(const Renderer &renderer, const UVector2 &size, const SDL_PixelFormat format, const SDL_TextureAccess access) {
-        if (_texture != nullptr)
-            SDL_DestroyTexture(_texture);
         _texture = SDL_CreateTexture(renderer, format, access, static_cast<int>(size.x), static_cast<int>(size.y));
         if (_texture == nullptr)
             Error::Throw("SDL_CreateTexture");
     }
 
     void Texture::LoadFile(const Renderer &renderer, const std::string &file) {
-        if (_texture != nullptr)
-            SDL_DestroyTexture(_texture);
         _texture = IMG_LoadTexture(renderer, file.c_str());
+        if (_texture == nullptr)
+            Error::Throw("IMG_LoadTexture");
     }
 
     FVector2 Texture::GetSize() const {
@@ -62,6 +64,26 @@ namespace SDL {
             Error::Throw("SDL_LockTexture");
     }
 
+    Texture::LockedPixels Texture::Lock(const std::optional<Rect<>> &rect) {
+        const SDL_Texture *texture = Get();
+        if (SDL_ISPIXELFORMAT_FOURCC(texture->format)) {
+            Error::Throw("SDL::Texture::Lock", "FOURCC formats have no per-pixel rows; use the raw pointer overload");
+            return {};
+        }
+        const SDL_Rect sdl_rect = rect.value_or(Rect<>());
+        void *pixels;
+        int pitch;
+        if (!SDL_LockTexture(_texture, rect ? &sdl_rect : nullptr, &pixels, &pitch)) {
+            Error::Throw("SDL_LockTexture");
+            return {};
+        }
+        const Vector2<> size = rect ? rect->size : Vector2<>(texture->w, texture->h);
+        std::size_t bytes = 0;
+        if (size.y > 0)
+            bytes = static_cast<std::size_t>(size.y - 1) * pitch + static_cast<std::size_t>(size.x) * SDL_BYTESPERPIXEL(texture->format);
+        return {{static_cast<std::byte *>(pixels), bytes}, pitch, size, texture->format};
+    }
+
     void Texture::Unlock() {
         SDL_UnlockTexture(_texture);
     }
@@ -0,0 +1,133 @@
+#include "SDLPP/TextureAtlas.hpp"
+
+#include <limits>
+
+#include "SDLPP/Error.hpp"
+#include "SDLPP/Renderer.hpp"
+
+namespace SDL {
+    FVector2 TextureAtlas::Region::TexCoord(const FVector2 &coord) const {
+        return uv.position + uv.size * coord;
+    }
+
+    TextureAtlas::TextureAtlas(const Renderer &renderer, const UVector2 &pageSize, const unsigned int padding,
+        const SDL_PixelFormat format): _renderer(renderer), _pageSize(pageSize), _padding(padding), _format(format) {
+
+    }
+
+    TextureAtlas::Region TextureAtlas::Add(const Surface &surface) {
+        const Vector2<> size = surface.GetSize();
+        const Vector2<> packedSize = size + Vector2<>(static_cast<int>(_padding), static_cast<int>(_padding));
+        if (packedSize.x > static_cast<int>(_pageSize.x) || packedSize.y > static_cast<int>(_pageSize.y))
+            Error::Throw("SDL::TextureAtlas::Add", "Surface is larger than an atlas page");
+
+        std::size_t page = 0;
+        std::optional<Rect<>> packed;
+        for (; page < _pages.size() && !packed; ++page)
+            packed = Pack(_pages[page], packedSize);
+        if (packed) {
+            --page;
+        } else {
+            packed = Pack(AddPage(), packedSize);
+            page = _pages.size() - 1;
+        }
+
+        const Rect<> rect(packed->position, size);
+        if (size.x > 0 && size.y > 0) {
+            if (surface.Get()->format == _format && !SDL_MUSTLOCK(surface.Get())) {
+                _pages[page].texture.Update(rect, surface.Get()->pixels, surface.Get()->pitch);
+            } else {
+                const Surface converted = surface.Convert(_format);
+                _pages[page].texture.Update(rect, converted.Get()->pixels, converted.Get()->pitch);
+            }
+        }
+
+        const FVector2 scale(1.0f / static_cast<float>(_pageSize.x), 1.0f / static_cast<float>(_pageSize.y));
+        return {page, rect, {FVector2(rect.position) * scale, FVector2(rect.size) * scale}};
+    }
+
+    void TextureAtlas::Clear() {
+        _pages.clear();
+    }
+
+    std::size_t TextureAtlas::PageCount() const {
+        return _pages.size();
+    }
+
+    const Texture &TextureAtlas::GetTexture(const std::size_t page) const {
+        return _pages[page].texture;
+    }
+
+    const Texture &TextureAtlas::GetTexture(const Region &region) const {
+        return _pages[region.page].texture;
+    }
+
+    const UVector2 &TextureAtlas::GetPageSize() const {
+        return _pageSize;
+    }
+
+    TextureAtlas::Page &TextureAtlas::AddPage() {
+        Page &page = _pages.emplace_back();
+        page.texture.Create(_renderer, _pageSize, _format, SDL_TEXTUREACCESS_STATIC);
+        page.skyline.push_back({0, 0, static_cast<int>(_pageSize.x)});
+
+        const int pitch = static_cast<int>(_pageSize.x) * SDL_BYTESPERPIXEL(_format);
+        const std::vector<Uint8> blank(static_cast<std::size_t>(pitch) * _pageSize.y);
+        page.texture.Update({0, 0, static_cast<int>(_pageSize.x), static_cast<int>(_pageSize.y)}, blank.data(), pitch);
+        return page;
+    }
+
+    std::optional<Rect<>> TextureAtlas::Pack(Page &page, const Vector2<> &size) const {
+        std::vector<SkylineNode> &skyline = page.skyline;
+        const int width = static_cast<int>(_pageSize.x);
+        const int height = static_cast<int>(_pageSize.y);
+
+        std::size_t best = skyline.size();
+        int bestY = std::numeric_limits<int>::max();
+        int bestWidth = std::numeric_limits<int>::max();
+        for (std::size_t i = 0; i < skyline.size(); ++i) {
+            const int x = skyline[i].x;
+            if (x + size.x > width)
+                break;
+            int y = 0;
+            int remaining = size.x;
+            for (std::size_t j = i; remaining > 0; ++j) {
+                y = std::max(y, skyline[j].y);
+                remaining -= skyline[j].width;
+            }
+            if (y + size.y > height)
+                continue;
+            if (y < bestY || (y == bestY && skyline[i].width < bestWidth)) {
+                best = i;
+                bestY = y;
+                bestWidth = skyline[i].width;
+            }
+        }
+        if (best == skyline.size())
+            return std::nullopt;
+
+        const int x = skyline[best].x;
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(best), {x, bestY + size.y, size.x});
+        for (std::size_t i = best + 1; i < skyline.size();) {
+            SkylineNode &node = skyline[i];
+            const int shrink = x + size.x - node.x;
+            if (shrink <= 0)
+                break;
+            if (node.width > shrink) {
+                node.x += shrink;
+                node.width -= shrink;
+                break;
+            }
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        for (std::size_t i = 0; i + 1 < skyline.size();) {
+            if (skyline[i].y == skyline[i + 1].y) {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i) + 1);
+            } else {
+                ++i;
+            }
+        }
+        return Rect<>(x, bestY, size.x, size.y);
+    }
+}
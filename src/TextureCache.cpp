@@ -0,0 +1,99 @@
+#include "SDLPP/TextureCache.hpp"
+
+#include "SDLPP/Error.hpp"
+#include "SDLPP/Renderer.hpp"
+
+namespace SDL {
+    TextureCache::TextureCache(const Renderer &renderer, const std::size_t budget): _renderer(renderer), _budget(budget) {
+
+    }
+
+    std::shared_ptr<const Texture> TextureCache::Load(const std::string &path, const SDL_ScaleMode scaleMode) {
+        std::string key = path;
+        key += '\n';
+        key += std::to_string(scaleMode);
+
+        if (const auto it = _lookup.find(key); it != _lookup.end()) {
+            _entries.splice(_entries.begin(), _entries, it->second);
+            ++_stats.hits;
+            return it->second->texture;
+        }
+
+        auto texture = std::make_shared<Texture>();
+        texture->LoadFile(_renderer, path);
+        if (!SDL_SetTextureScaleMode(texture->Get(), scaleMode))
+            Error::Throw("SDL_SetTextureScaleMode");
+        ++_stats.misses;
+
+        const std::size_t bytes = EstimateBytes(*texture);
+        _entries.push_front({key, texture, bytes});
+        _lookup.emplace(std::move(key), _entries.begin());
+        _residentBytes += bytes;
+        Trim();
+        return texture;
+    }
+
+    void TextureCache::Trim() {
+        for (auto it = _entries.end(); it != _entries.begin() && _residentBytes > _budget;) {
+            --it;
+            if (it->texture.use_count() > 1)
+                continue;
+            _residentBytes -= it->bytes;
+            _lookup.erase(it->key);
+            it = _entries.erase(it);
+            ++_stats.evictions;
+        }
+    }
+
+    void TextureCache::Clear() {
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            if (it->texture.use_count() > 1) {
+                ++it;
+                continue;
+            }
+            _residentBytes -= it->bytes;
+            _lookup.erase(it->key);
+            it = _entries.erase(it);
+        }
+    }
+
+    void TextureCache::SetBudget(const std::size_t bytes) {
+        _budget = bytes;
+        Trim();
+    }
+
+    std::size_t TextureCache::GetBudget() const {
+        return _budget;
+    }
+
+    std::size_t TextureCache::GetCount() const {
+        return _entries.size();
+    }
+
+    std::size_t TextureCache::GetResidentBytes() const {
+        return _residentBytes;
+    }
+
+    double TextureCache::GetHitRate() const {
+        const std::size_t total = _stats.hits + _stats.misses;
+        return total == 0 ? 0.0 : static_cast<double>(_stats.hits) / static_cast<double>(total);
+    }
+
+    const TextureCache::Stats &TextureCache::GetStats() const {
+        return _stats;
+    }
+
+    void TextureCache::ResetStats() {
+        _stats = {};
+    }
+
+    std::size_t TextureCache::EstimateBytes(const Texture &texture) {
+        const SDL_Texture *sdl_texture = texture.Get();
+        if (!sdl_texture)
+            return 0;
+        const std::size_t pixels = static_cast<std::size_t>(sdl_texture->w) * sdl_texture->h;
+        if (SDL_ISPIXELFORMAT_FOURCC(sdl_texture->format))
+            return pixels * 3 / 2;
+        return pixels * SDL_BYTESPERPIXEL(sdl_texture->format);
+    }
+}
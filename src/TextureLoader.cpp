@@ -0,0 +1,145 @@
+#include "SDLPP/TextureLoader.hpp"
+
+#include <algorithm>
+
+#include "SDLPP/Error.hpp"
+#include "SDLPP/Renderer.hpp"
+#include "SDL3_image/SDL_image.h"
+
+namespace SDL {
+    TextureLoader::Handle::Handle() = default;
+
+    TextureLoader::Handle::Handle(std::shared_ptr<Request> request): _request(std::move(request)) {
+
+    }
+
+    bool TextureLoader::Handle::IsValid() const {
+        return _request != nullptr;
+    }
+
+    bool TextureLoader::Handle::IsReady() const {
+        return _request && _request->state == Ready;
+    }
+
+    bool TextureLoader::Handle::HasFailed() const {
+        return _request && _request->state == Failed;
+    }
+
+    const std::string &TextureLoader::Handle::GetPath() const {
+        static const std::string empty;
+        return _request ? _request->path : empty;
+    }
+
+    std::string TextureLoader::Handle::GetError() const {
+        if (!HasFailed())
+            return {};
+        return _request->error;
+    }
+
+    Texture &TextureLoader::Handle::Get() const {
+        if (!_request)
+            Error::Throw("SDL::TextureLoader::Handle::Get", "Handle is empty");
+        else if (_request->state == Failed)
+            Error::Throw("SDL::TextureLoader::Handle::Get", _request->error.c_str());
+        else if (_request->state != Ready)
+            Error::Throw("SDL::TextureLoader::Handle::Get", "Texture is still loading");
+        return _request->texture;
+    }
+
+    TextureLoader::TextureLoader(const Renderer &renderer, ThreadPool &pool, const std::size_t uploadBudget): _renderer(renderer), _pool(pool), _uploadBudget(uploadBudget) {
+
+    }
+
+    TextureLoader::Handle TextureLoader::LoadAsync(const std::string &path) {
+        auto request = std::make_shared<Request>();
+        request->path = path;
+        ++_pending;
+        _pool.Submit([request, queue = _queue] {
+            SDL_Surface *loaded = IMG_Load(request->path.c_str());
+            if (loaded) {
+                Surface surface(loaded);
+                if (surface.Get()->format == SDL_PIXELFORMAT_RGBA32 && !SDL_MUSTLOCK(surface.Get()))
+                    request->surface = std::move(surface);
+                else if (SDL_Surface *converted = SDL_ConvertSurface(surface.Get(), SDL_PIXELFORMAT_RGBA32))
+                    request->surface = Surface(converted);
+            }
+            if (!request->surface.Get())
+                request->error = SDL_GetError();
+            std::lock_guard lock(queue->mutex);
+            queue->decoded.push_back(request);
+        });
+        return Handle(request);
+    }
+
+    void TextureLoader::Update() {
+        {
+            std::lock_guard lock(_queue->mutex);
+            while (!_queue->decoded.empty()) {
+                _uploading.push_back(std::move(_queue->decoded.front()));
+                _queue->decoded.pop_front();
+            }
+        }
+
+        if (_uploadBudget == 0)
+            return;
+        std::size_t uploaded = 0;
+        while (!_uploading.empty()) {
+            Request &request = *_uploading.front();
+            if (!request.surface.Get()) {
+                request.state = Failed;
+            } else if (!Upload(request, uploaded)) {
+                break;
+            }
+            _uploading.pop_front();
+            --_pending;
+        }
+    }
+
+    void TextureLoader::SetUploadBudget(const std::size_t bytes) {
+        _uploadBudget = bytes;
+    }
+
+    std::size_t TextureLoader::GetUploadBudget() const {
+        return _uploadBudget;
+    }
+
+    std::size_t TextureLoader::GetPendingCount() const {
+        return _pending;
+    }
+
+    std::size_t TextureLoader::GetUploadedBytes() const {
+        return _uploadedBytes;
+    }
+
+    bool TextureLoader::Upload(Request &request, std::size_t &uploaded) {
+        const SDL_Surface *surface = request.surface.Get();
+        if (!request.texture) {
+            request.texture = Texture(SDL_CreateTexture(_renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, surface->w, surface->h));
+            if (!request.texture) {
+                request.error = SDL_GetError();
+                request.state = Failed;
+                request.surface = Surface();
+                return true;
+            }
+            request.state = Uploading;
+        }
+
+        const auto pitch = static_cast<std::size_t>(surface->pitch);
+        while (request.uploadedRows < surface->h) {
+            const std::size_t remaining = _uploadBudget - std::min(uploaded, _uploadBudget);
+            if (remaining < pitch && uploaded != 0)
+                return false;
+            const int rows = static_cast<int>(std::clamp<std::size_t>(remaining / std::max<std::size_t>(pitch, 1), 1, surface->h - request.uploadedRows));
+            const auto *pixels = static_cast<const unsigned char *>(surface->pixels) + request.uploadedRows * pitch;
+            request.texture.Update({0, request.uploadedRows, surface->w, rows}, pixels, surface->pitch);
+            request.uploadedRows += rows;
+            const std::size_t bytes = rows * pitch;
+            uploaded += bytes;
+            _uploadedBytes += bytes;
+        }
+
+        request.surface = Surface();
+        request.state = Ready;
+        return true;
+    }
+}
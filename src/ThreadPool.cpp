@@ -0,0 +1,97 @@
+#include "SDLPP/ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace SDL {
+    ThreadPool::ThreadPool(const std::size_t threads) {
+        const std::size_t count = std::max<std::size_t>(threads, 1);
+        _threads.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            _threads.emplace_back(&ThreadPool::Work, this);
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _taskAvailable.notify_all();
+        for (std::thread &thread : _threads)
+            thread.join();
+    }
+
+    void ThreadPool::Submit(std::function<void()> task) {
+        {
+            std::lock_guard lock(_mutex);
+            _tasks.push_back(std::move(task));
+        }
+        _taskAvailable.notify_one();
+    }
+
+    void ThreadPool::Wait() {
+        std::unique_lock lock(_mutex);
+        _idle.wait(lock, [this] { return _tasks.empty() && _active == 0; });
+    }
+
+    void ThreadPool::ParallelFor(const std::size_t count, const std::function<void(std::size_t, std::size_t)> &body) {
+        if (count == 0)
+            return;
+        struct State {
+            std::atomic<std::size_t> next = 0;
+            std::atomic<std::size_t> completed = 0;
+            std::exception_ptr error;
+            std::mutex errorMutex;
+        };
+        const auto state = std::make_shared<State>();
+        const auto run = [state, count, &body](const std::size_t slot) {
+            for (std::size_t i = state->next++; i < count; i = state->next++) {
+                try {
+                    body(i, slot);
+                } catch (...) {
+                    std::lock_guard lock(state->errorMutex);
+                    if (!state->error)
+                        state->error = std::current_exception();
+                }
+                if (++state->completed == count)
+                    state->completed.notify_all();
+            }
+        };
+        const std::size_t helpers = std::min(count - 1, _threads.size());
+        {
+            std::lock_guard lock(_mutex);
+            for (std::size_t i = helpers; i > 0; --i)
+                _tasks.emplace_front([run, i] { run(i); });
+        }
+        for (std::size_t i = 0; i < helpers; ++i)
+            _taskAvailable.notify_one();
+        run(0);
+        for (std::size_t completed = state->completed; completed != count; completed = state->completed)
+            state->completed.wait(completed);
+        if (state->error)
+            std::rethrow_exception(state->error);
+    }
+
+    std::size_t ThreadPool::GetThreadCount() const {
+        return _threads.size();
+    }
+
+    void ThreadPool::Work() {
+        std::unique_lock lock(_mutex);
+        while (true) {
+            _taskAvailable.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty())
+                return;
+            std::function<void()> task = std::move(_tasks.front());
+            _tasks.pop_front();
+            ++_active;
+            lock.unlock();
+            task();
+            lock.lock();
+            if (--_active == 0 && _tasks.empty())
+                _idle.notify_all();
+        }
+    }
+}
@@ -0,0 +1,155 @@
+#include "SDLPP/TileMap.hpp"
+
+#include <algorithm>
+
+#include "SDLPP/Error.hpp"
+#include "SDLPP/Renderer.hpp"
+
+namespace SDL {
+    TileMap::TileMap(const UVector2 &size, const UVector2 &tileSize, const unsigned int chunkSize): _size(size), _tileSize(tileSize),
+        _chunkSize(std::max(chunkSize, 1u)), _tiles(static_cast<std::size_t>(size.x) * size.y, Empty) {
+        _chunks = {(size.x + _chunkSize - 1) / _chunkSize, (size.y + _chunkSize - 1) / _chunkSize};
+        _chunkData.resize(static_cast<std::size_t>(_chunks.x) * _chunks.y);
+    }
+
+    void TileMap::SetTileset(const Texture &tileset) {
+        _tileset = Texture(tileset.Get(), Borrowed());
+        for (Chunk &chunk : _chunkData)
+            chunk.dirty = true;
+    }
+
+    void TileMap::SetTile(const UVector2 &position, const int tile) {
+        if (position.x >= _size.x || position.y >= _size.y)
+            Error::Throw("SDL::TileMap::SetTile", "Position is outside of the map");
+        int &current = _tiles[static_cast<std::size_t>(position.y) * _size.x + position.x];
+        if (current == tile)
+            return;
+        current = tile;
+        _chunkData[GetChunkIndex(position)].dirty = true;
+    }
+
+    int TileMap::GetTile(const UVector2 &position) const {
+        if (position.x >= _size.x || position.y >= _size.y)
+            Error::Throw("SDL::TileMap::GetTile", "Position is outside of the map");
+        return _tiles[static_cast<std::size_t>(position.y) * _size.x + position.x];
+    }
+
+    void TileMap::Fill(const int tile) {
+        std::ranges::fill(_tiles, tile);
+        for (Chunk &chunk : _chunkData)
+            chunk.dirty = true;
+    }
+
+    void TileMap::SetPosition(const FVector2 &position) {
+        _position = position;
+    }
+
+    const FVector2 &TileMap::GetPosition() const {
+        return _position;
+    }
+
+    const UVector2 &TileMap::GetSize() const {
+        return _size;
+    }
+
+    const UVector2 &TileMap::GetTileSize() const {
+        return _tileSize;
+    }
+
+    std::size_t TileMap::GetChunkCount() const {
+        return _chunkData.size();
+    }
+
+    std::size_t TileMap::GetDrawnChunkCount() const {
+        return _drawn;
+    }
+
+    std::size_t TileMap::GetRebuildCount() const {
+        return _rebuilds;
+    }
+
+    void TileMap::Draw(Renderer &renderer) const {
+        _drawn = 0;
+        if (!_tileset)
+            return;
+        const Rect<> viewport = renderer.GetViewport();
+        const FRect visible({0, 0}, FVector2(viewport.size));
+        for (std::size_t i = 0; i < _chunkData.size(); ++i) {
+            if (!GetChunkBounds(i).Intersects(visible))
+                continue;
+            Chunk &chunk = _chunkData[i];
+            if (chunk.dirty)
+                Rebuild(i);
+            else if (chunk.origin != _position)
+                Translate(chunk);
+            if (chunk.vertices.VertexCount() == 0)
+                continue;
+            renderer.Draw(chunk.vertices, _tileset);
+            ++_drawn;
+        }
+    }
+
+    std::size_t TileMap::GetChunkIndex(const UVector2 &position) const {
+        return static_cast<std::size_t>(position.y / _chunkSize) * _chunks.x + position.x / _chunkSize;
+    }
+
+    FRect TileMap::GetChunkBounds(const std::size_t chunk) const {
+        const UVector2 first(static_cast<unsigned int>(chunk % _chunks.x) * _chunkSize, static_cast<unsigned int>(chunk / _chunks.x) * _chunkSize);
+        const UVector2 tiles(std::min(_chunkSize, _size.x - first.x), std::min(_chunkSize, _size.y - first.y));
+        return {_position + FVector2(first * _tileSize), FVector2(tiles * _tileSize)};
+    }
+
+    void TileMap::Rebuild(const std::size_t chunk) const {
+        Chunk &data = _chunkData[chunk];
+        data.vertices.Clear();
+        data.offsets.clear();
+        data.origin = _position;
+        data.dirty = false;
+        ++_rebuilds;
+
+        const FVector2 textureSize = _tileset.GetSize();
+        const unsigned int columns = static_cast<unsigned int>(textureSize.x) / std::max(_tileSize.x, 1u);
+        const unsigned int rows = static_cast<unsigned int>(textureSize.y) / std::max(_tileSize.y, 1u);
+        if (columns == 0 || rows == 0)
+            return;
+        const FVector2 tileSize(_tileSize);
+        const FVector2 uvScale(1.0f / textureSize.x, 1.0f / textureSize.y);
+        const UVector2 first(static_cast<unsigned int>(chunk % _chunks.x) * _chunkSize, static_cast<unsigned int>(chunk / _chunks.x) * _chunkSize);
+        const UVector2 last(std::min(first.x + _chunkSize, _size.x), std::min(first.y + _chunkSize, _size.y));
+
+        static constexpr int quad[6] = {0, 1, 2, 2, 3, 0};
+        for (unsigned int y = first.y; y < last.y; ++y) {
+            for (unsigned int x = first.x; x < last.x; ++x) {
+                const int tile = _tiles[static_cast<std::size_t>(y) * _size.x + x];
+                if (tile < 0 || static_cast<unsigned int>(tile) >= columns * rows)
+                    continue;
+                const FVector2 offset(UVector2(x, y) * _tileSize);
+                const FVector2 position = _position + offset;
+                const FVector2 uv = FVector2(UVector2(tile % columns, tile / columns)) * tileSize * uvScale;
+                const FVector2 uvSize = tileSize * uvScale;
+                const int base = static_cast<int>(data.vertices.VertexCount());
+                const std::span<Vertex> vertices = data.vertices.Map(4);
+                vertices[0] = {position, Color::White, uv};
+                vertices[1] = {position + FVector2(tileSize.x, 0), Color::White, uv + FVector2(uvSize.x, 0)};
+                vertices[2] = {position + tileSize, Color::White, uv + uvSize};
+                vertices[3] = {position + FVector2(0, tileSize.y), Color::White, uv + FVector2(0, uvSize.y)};
+                data.vertices.Append(quad, base);
+                data.offsets.push_back(offset);
+            }
+        }
+        data.vertices.Finalize();
+    }
+
+    void TileMap::Translate(Chunk &chunk) const {
+        const FVector2 tileSize(_tileSize);
+        const FVector2 corners[4] = {{0, 0}, {tileSize.x, 0}, tileSize, {0, tileSize.y}};
+        for (std::size_t i = 0; i < chunk.offsets.size(); ++i) {
+            const FVector2 position = _position + chunk.offsets[i];
+            for (std::size_t corner = 0; corner < 4; ++corner) {
+                SDL_Vertex &vertex = chunk.vertices.GetVertex(i * 4 + corner);
+                vertex.position = position + corners[corner];
+            }
+        }
+        chunk.origin = _position;
+    }
+}
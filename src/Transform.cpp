@@ -1,76 +1,156 @@
 #include "SDLPP/Transform.hpp"
 
+#include <algorithm>
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_intrin.h>
+
+#include "SDLPP/Error.hpp"
 #include "SDLPP/Math.hpp"
 
 namespace SDL {
-    Transform::Transform() {
+    static_assert(sizeof(FVector2) == sizeof(float) * 2);
+
+    static void ApplyBatchScalar(const float *m, const float *points, float *result, const std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const float x = points[i * 2];
+            const float y = points[i * 2 + 1];
+            result[i * 2] = m[0] * x + m[1] * y + m[2];
+            result[i * 2 + 1] = m[3] * x + m[4] * y + m[5];
+        }
+    }
 
+#if defined(SDL_SSE_INTRINSICS)
+    SDL_TARGETING("sse") static void ApplyBatchSSE(const float *m, const float *points, float *result, const std::size_t count) {
+        const __m128 mx = _mm_setr_ps(m[0], m[3], m[0], m[3]);
+        const __m128 my = _mm_setr_ps(m[1], m[4], m[1], m[4]);
+        const __m128 mt = _mm_setr_ps(m[2], m[5], m[2], m[5]);
+        std::size_t i = 0;
+        for (; i + 2 <= count; i += 2) {
+            const __m128 p = _mm_loadu_ps(points + i * 2);
+            const __m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+            const __m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+            _mm_storeu_ps(result + i * 2, _mm_add_ps(_mm_add_ps(_mm_mul_ps(mx, x), _mm_mul_ps(my, y)), mt));
+        }
+        ApplyBatchScalar(m, points + i * 2, result + i * 2, count - i);
     }
+#elif defined(SDL_NEON_INTRINSICS)
+    static void ApplyBatchNEON(const float *m, const float *points, float *result, const std::size_t count) {
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const float32x4x2_t p = vld2q_f32(points + i * 2);
+            float32x4x2_t r;
+            r.val[0] = vaddq_f32(vaddq_f32(vmulq_n_f32(p.val[0], m[0]), vmulq_n_f32(p.val[1], m[1])), vdupq_n_f32(m[2]));
+            r.val[1] = vaddq_f32(vaddq_f32(vmulq_n_f32(p.val[0], m[3]), vmulq_n_f32(p.val[1], m[4])), vdupq_n_f32(m[5]));
+            vst2q_f32(result + i * 2, r);
+        }
+        ApplyBatchScalar(m, points + i * 2, result + i * 2, count - i);
+    }
+#endif
 
-    Transform::Transform(const FMatrix3x3 &matrix): _transform(matrix) {
+    Transform::Transform() {
 
     }
 
-    Transform &Transform::Translate(const FVector2 &delta) {
-        const FMatrix3x3 matrix(
-            1, 0, delta.x,
-            0, 1, delta.y,
-            0, 0,        1
-        );
+    Transform::Transform(const FMatrix3x3 &matrix): _matrix{matrix.Data()[0], matrix.Data()[1], matrix.Data()[2],
+                                                            matrix.Data()[3], matrix.Data()[4], matrix.Data()[5]} {
+        if (matrix.Data()[6] != 0 || matrix.Data()[7] != 0 || matrix.Data()[8] != 1)
+            Error::Throw("SDL::Transform::Transform", "Matrix is not affine");
+    }
 
-        return *this *= matrix;
+    Transform &Transform::Translate(const FVector2 &delta) {
+        float *m = _matrix;
+        m[2] = m[0] * delta.x + m[1] * delta.y + m[2];
+        m[5] = m[3] * delta.x + m[4] * delta.y + m[5];
+        return *this;
     }
 
     Transform &Transform::Rotate(const Angle &angle) {
-        const FMatrix3x3 matrix(
-            Cos(angle), -Sin(angle), 0,
-            Sin(angle),  Cos(angle), 0,
-                     0,           0, 1
-        );
-
-        return *this *= matrix;
+        const float c = Cos(angle);
+        const float s = Sin(angle);
+        float *m = _matrix;
+        const float m0 = m[0], m3 = m[3];
+        m[0] = m0 * c + m[1] * s;
+        m[1] = m0 * -s + m[1] * c;
+        m[3] = m3 * c + m[4] * s;
+        m[4] = m3 * -s + m[4] * c;
+        return *this;
     }
 
     Transform &Transform::Scale(const FVector2 &scale) {
-        const FMatrix3x3 matrix(
-            scale.x,       0, 0,
-                  0, scale.y, 0,
-                  0,       0, 1
-        );
-
-        return *this *= matrix;
+        float *m = _matrix;
+        m[0] *= scale.x;
+        m[1] *= scale.y;
+        m[3] *= scale.x;
+        m[4] *= scale.y;
+        return *this;
     }
 
     Transform Transform::operator*(const Transform &other) const {
-        return {_transform * other._transform};
+        Transform result = *this;
+        return result *= other;
     }
 
     Transform &Transform::operator*=(const Transform &other) {
-        _transform *= other._transform;
+        const float *a = _matrix;
+        const float *b = other._matrix;
+        const float r[6] = {
+            a[0] * b[0] + a[1] * b[3], a[0] * b[1] + a[1] * b[4], a[0] * b[2] + a[1] * b[5] + a[2],
+            a[3] * b[0] + a[4] * b[3], a[3] * b[1] + a[4] * b[4], a[3] * b[2] + a[4] * b[5] + a[5]
+        };
+        std::copy_n(r, 6, _matrix);
         return *this;
     }
 
     FVector2 Transform::Apply(const FVector2 &point) const {
-        return static_cast<FVector2>(_transform * FMatrix3x3(point));
+        const float *m = _matrix;
+        return {m[0] * point.x + m[1] * point.y + m[2], m[3] * point.x + m[4] * point.y + m[5]};
     }
 
     FVector3 Transform::Apply(const FVector3 &point) const {
-        return static_cast<FVector3>(_transform * FMatrix3x3(point));
+        const float *m = _matrix;
+        return {m[0] * point.x + m[1] * point.y + m[2] * point.z, m[3] * point.x + m[4] * point.y + m[5] * point.z, point.z};
+    }
+
+    void Transform::ApplyBatch(const std::span<FVector2> points) const {
+        ApplyBatch(points, points);
+    }
+
+    void Transform::ApplyBatch(const std::span<const FVector2> points, const std::span<FVector2> result) const {
+        const std::size_t count = std::min(points.size(), result.size());
+        const auto *in = reinterpret_cast<const float *>(points.data());
+        auto *out = reinterpret_cast<float *>(result.data());
+#if defined(SDL_SSE_INTRINSICS)
+        if (SDL_HasSSE()) {
+            ApplyBatchSSE(_matrix, in, out, count);
+            return;
+        }
+#elif defined(SDL_NEON_INTRINSICS)
+        ApplyBatchNEON(_matrix, in, out, count);
+        return;
+#endif
+        ApplyBatchScalar(_matrix, in, out, count);
     }
 
     Transform Transform::Inverse() const {
-        const float *m = _transform.Data();
-        const float det = m[0]*m[4]*m[8] + m[1]*m[5]*m[6] + m[2]*m[3]*m[7];
+        const float *m = _matrix;
+        const float det = m[0] * m[4] - m[1] * m[3];
         if (det == 0)
-            return FMatrix3x3::Identity;
+            return {};
         return FMatrix3x3(
-             (m[4]*m[8] - m[5]*m[7]) / det, -(m[1]*m[8] - m[2]*m[7]) / det,  (m[1]*m[5] - m[2]*m[4]) / det,
-            -(m[3]*m[8] - m[5]*m[6]) / det,  (m[0]*m[8] - m[2]*m[6]) / det, -(m[0]*m[5] - m[2]*m[3]) / det,
-             (m[3]*m[7] - m[4]*m[6]) / det, -(m[0]*m[7] - m[1]*m[6]) / det,  (m[0]*m[4] - m[1]*m[3]) / det
+             m[4] / det, -m[1] / det, (m[1] * m[5] - m[4] * m[2]) / det,
+            -m[3] / det,  m[0] / det, (m[3] * m[2] - m[0] * m[5]) / det,
+                      0,           0,                                  1
         );
     }
 
-    const FMatrix3x3 &Transform::GetMatrix() const {
-        return _transform;
+    FMatrix3x3 Transform::GetMatrix() const {
+        const float *m = _matrix;
+        return {m[0], m[1], m[2],
+                m[3], m[4], m[5],
+                   0,    0,    1};
+    }
+
+    const float *Transform::Data() const {
+        return _matrix;
     }
 }
@@ -4,8 +4,10 @@ namespace SDL {
     Transformable::Transformable()= default;
 
     void Transformable::SetPosition(const FVector2 &position) {
+        const FVector2 delta = position - _position;
         _position = position;
-        RecomputeTransform();
+        _transformDirty = true;
+        InvalidateTranslation(delta);
     }
 
     const FVector2 &Transformable::GetPosition() const {
@@ -14,7 +16,8 @@ namespace SDL {
 
     void Transformable::SetScale(const FVector2 &scale) {
         _scale = scale;
-        RecomputeTransform();
+        _transformDirty = true;
+        InvalidateTransform();
     }
 
     const FVector2 &Transformable::GetScale() const {
@@ -23,7 +26,8 @@ namespace SDL {
 
     void Transformable::SetRotation(const Angle &rotation) {
         _rotation = rotation;
-        RecomputeTransform();
+        _transformDirty = true;
+        InvalidateTransform();
     }
 
     const Angle &Transformable::GetRotation() const {
@@ -32,7 +36,8 @@ namespace SDL {
 
     void Transformable::SetOrigin(const FVector2 &origin) {
         _origin = origin;
-        RecomputeTransform();
+        _transformDirty = true;
+        InvalidateTransform();
     }
 
     const FVector2 &Transformable::GetOrigin() const {
@@ -40,21 +45,27 @@ namespace SDL {
     }
 
     const Transform &Transformable::GetTransform() const {
+        if (_transformDirty)
+            RecomputeTransform();
         return _transform;
     }
 
     void Transformable::Transform(FVector2 &v) const {
-        v = _transform.Apply(v);
+        v = GetTransform().Apply(v);
     }
 
-    void Transformable::RecomputeTransform() {
+    void Transformable::Transform(const std::span<FVector2> points) const {
+        GetTransform().ApplyBatch(points);
+    }
+
+    void Transformable::RecomputeTransform() const {
         SDL::Transform transform;
         transform.Translate(_position);
         transform.Rotate(_rotation);
         transform.Scale(_scale);
         transform.Translate(-_origin);
         _transform = transform;
-        Recompute();
+        _transformDirty = false;
     }
 
 
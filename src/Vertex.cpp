@@ -1,5 +1,11 @@
 #include "SDLPP/Vertex.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "SDLPP/Error.hpp"
+
 namespace SDL {
     Vertex::Vertex() = default;
 
@@ -12,14 +18,63 @@ namespace SDL {
     }
 
     Vertex::operator SDL_Vertex() const {
-        return {position, color, texCoord};
+        return std::bit_cast<SDL_Vertex>(*this);
+    }
+
+    namespace {
+        Uint32 ReadIndex(const unsigned char *data, const int indexSize) {
+            switch (indexSize) {
+                case sizeof(Uint8):
+                    return *data;
+                case sizeof(Uint16): {
+                    Uint16 index;
+                    std::memcpy(&index, data, sizeof(Uint16));
+                    return index;
+                }
+                default: {
+                    Uint32 index;
+                    std::memcpy(&index, data, sizeof(Uint32));
+                    return index;
+                }
+            }
+        }
+
+        void WriteIndex(unsigned char *data, const int indexSize, const Uint32 index) {
+            switch (indexSize) {
+                case sizeof(Uint8):
+                    *data = static_cast<Uint8>(index);
+                    break;
+                case sizeof(Uint16): {
+                    const auto narrow = static_cast<Uint16>(index);
+                    std::memcpy(data, &narrow, sizeof(Uint16));
+                    break;
+                }
+                default:
+                    std::memcpy(data, &index, sizeof(Uint32));
+                    break;
+            }
+        }
+    }
+
+    void ConvertIndices(const void *indices, const int indexSize, const std::size_t indexCount, int *out) {
+        const auto *data = static_cast<const unsigned char *>(indices);
+        if (indexSize == sizeof(int)) {
+            std::memcpy(out, data, indexCount * sizeof(int));
+            return;
+        }
+        for (std::size_t i = 0; i < indexCount; ++i)
+            out[i] = static_cast<int>(ReadIndex(data + i * indexSize, indexSize));
     }
 
     VertexBuffer::VertexBuffer() = default;
 
+    VertexBuffer::VertexBuffer(std::pmr::memory_resource *resource): _vertices(resource), _indices(resource) {
+
+    }
+
     void VertexBuffer::Clear() {
         _vertices.clear();
-        _indices.clear();
+        ClearIndices();
     }
 
     void VertexBuffer::ClearVertices() {
@@ -28,26 +83,113 @@ namespace SDL {
 
     void VertexBuffer::ClearIndices() {
         _indices.clear();
+        _maxIndex = 0;
     }
 
     void VertexBuffer::Add(const Vertex &vertex, const bool add_index) {
-        _vertices.emplace_back(vertex);
+        _vertices.push_back(std::bit_cast<SDL_Vertex>(vertex));
         if (add_index)
-            _indices.emplace_back(static_cast<int>(_vertices.size() - 1));
+            Add(static_cast<int>(_vertices.size() - 1));
+    }
+
+    void VertexBuffer::Add(const std::span<const Vertex> vertices) {
+        Append(vertices);
     }
 
-    void VertexBuffer::Add(int index) {
-        _indices.emplace_back(index);
+    void VertexBuffer::Add(const int index) {
+        const auto value = static_cast<Uint32>(index);
+        if (IndexSizeFor(value) > _indexSize)
+            Repack(IndexSizeFor(value));
+        _maxIndex = std::max(_maxIndex, value);
+        const std::size_t offset = _indices.size();
+        _indices.resize(offset + _indexSize);
+        WriteIndex(&_indices[offset], _indexSize, value);
     }
 
     void VertexBuffer::Add(const std::initializer_list<int> indices) {
-        _indices.insert(_indices.end(), indices.begin(), indices.end());
+        for (const int index : indices)
+            Add(index);
+    }
+
+    void VertexBuffer::Append(const std::span<const Vertex> vertices) {
+        const SDL_Vertex *data = AsSDLVertices(vertices.data());
+        _vertices.insert(_vertices.end(), data, data + vertices.size());
+    }
+
+    void VertexBuffer::Append(const std::span<const int> indices, const int baseVertex) {
+        if (indices.empty())
+            return;
+        Uint32 maxIndex = _maxIndex;
+        for (const int index : indices)
+            maxIndex = std::max(maxIndex, static_cast<Uint32>(index + baseVertex));
+        if (IndexSizeFor(maxIndex) > _indexSize)
+            Repack(IndexSizeFor(maxIndex));
+        _maxIndex = maxIndex;
+
+        const std::size_t offset = _indices.size();
+        _indices.resize(offset + indices.size() * _indexSize);
+        unsigned char *data = &_indices[offset];
+        for (const int index : indices) {
+            WriteIndex(data, _indexSize, static_cast<Uint32>(index + baseVertex));
+            data += _indexSize;
+        }
+    }
+
+    std::span<Vertex> VertexBuffer::Map(const std::size_t count) {
+        const std::size_t offset = _vertices.size();
+        _vertices.resize(offset + count);
+        return {reinterpret_cast<Vertex *>(_vertices.data() + offset), count};
+    }
+
+    void VertexBuffer::Reserve(const std::size_t vertexCount, const std::size_t indexCount) {
+        _vertices.reserve(vertexCount);
+        _indices.reserve(indexCount * _indexSize);
     }
 
     void VertexBuffer::Resize(const std::size_t size) {
         _vertices.resize(size);
     }
 
+    void VertexBuffer::SetIndexSize(const int indexSize) {
+        if (indexSize != sizeof(Uint8) && indexSize != sizeof(Uint16) && indexSize != sizeof(Uint32))
+            Error::Throw("SDL::VertexBuffer::SetIndexSize", "Index size must be 1, 2 or 4 bytes");
+        if (!_indices.empty() && IndexSizeFor(_maxIndex) > indexSize)
+            Error::Throw("SDL::VertexBuffer::SetIndexSize", "Indices do not fit in the requested size");
+        Repack(indexSize);
+    }
+
+    int VertexBuffer::GetIndexSize() const {
+        return _indexSize;
+    }
+
+    void VertexBuffer::Finalize() {
+        Repack(IndexSizeFor(_maxIndex));
+    }
+
+    int VertexBuffer::IndexSizeFor(const Uint32 index) {
+        if (index <= SDL_MAX_UINT8)
+            return sizeof(Uint8);
+        if (index <= SDL_MAX_UINT16)
+            return sizeof(Uint16);
+        return sizeof(Uint32);
+    }
+
+    void VertexBuffer::Repack(const int indexSize) {
+        if (indexSize == _indexSize)
+            return;
+        const std::size_t count = IndexCount();
+        if (indexSize > _indexSize) {
+            _indices.resize(count * indexSize);
+            for (std::size_t i = count; i-- > 0;)
+                WriteIndex(&_indices[i * indexSize], indexSize, ReadIndex(&_indices[i * _indexSize], _indexSize));
+        } else {
+            for (std::size_t i = 0; i < count; ++i)
+                WriteIndex(&_indices[i * indexSize], indexSize, ReadIndex(&_indices[i * _indexSize], _indexSize));
+            _indices.resize(count * indexSize);
+        }
+        _indexSize = indexSize;
+    }
+
     SDL_Vertex &VertexBuffer::GetVertex(const std::size_t i) {
         return _vertices[i];
     }
@@ -56,8 +198,8 @@ namespace SDL {
         return _vertices[i];
     }
 
-    const int &VertexBuffer::GetIndex(const std::size_t i) const {
-        return _indices[i];
+    int VertexBuffer::GetIndex(const std::size_t i) const {
+        return static_cast<int>(ReadIndex(&_indices[i * _indexSize], _indexSize));
     }
 
     std::size_t VertexBuffer::VertexCount() const {
@@ -69,10 +211,18 @@ namespace SDL {
     }
 
     std::size_t VertexBuffer::IndexCount() const {
-        return _indices.size();
+        return _indices.size() / _indexSize;
     }
 
     const int *VertexBuffer::Indices() const {
+        if (_indexSize != sizeof(int)) {
+            Error::Throw("SDL::VertexBuffer::Indices", "Indices are not 4 bytes wide; use IndexData()");
+            return nullptr;
+        }
+        return static_cast<const int *>(IndexData());
+    }
+
+    const void *VertexBuffer::IndexData() const {
         if (_indices.empty())
             return nullptr;
         return _indices.data();
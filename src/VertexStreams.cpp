@@ -0,0 +1,135 @@
+#include "SDLPP/VertexStreams.hpp"
+
+#include <type_traits>
+
+namespace SDL {
+    static_assert(std::is_standard_layout_v<FColor> && sizeof(FColor) == sizeof(SDL_FColor));
+    static_assert(std::is_standard_layout_v<FVector2> && sizeof(FVector2) == 2 * sizeof(float));
+
+    VertexStreams::VertexStreams() = default;
+
+    VertexStreams::VertexStreams(const std::size_t vertexCount): _positions(vertexCount) {
+
+    }
+
+    void VertexStreams::Clear() {
+        _positions.clear();
+        _indices.clear();
+        if (_vertexColors)
+            _colors.clear();
+        if (_vertexTexCoords)
+            _texCoords.clear();
+    }
+
+    void VertexStreams::ClearIndices() {
+        _indices.clear();
+    }
+
+    void VertexStreams::Resize(const std::size_t vertexCount) {
+        _positions.resize(vertexCount);
+        if (_vertexColors)
+            _colors.resize(vertexCount, FColor(1, 1, 1, 1));
+        if (_vertexTexCoords)
+            _texCoords.resize(vertexCount);
+    }
+
+    std::span<FVector2> VertexStreams::GetPositions() {
+        return _positions;
+    }
+
+    std::span<const FVector2> VertexStreams::GetPositions() const {
+        return _positions;
+    }
+
+    void VertexStreams::SetColor(const FColor &color) {
+        _colors.assign(1, color);
+        _vertexColors = false;
+    }
+
+    std::span<FColor> VertexStreams::GetColors() {
+        if (!_vertexColors) {
+            _colors.resize(_positions.size(), _colors.front());
+            _vertexColors = true;
+        }
+        return _colors;
+    }
+
+    std::span<const FColor> VertexStreams::GetColors() const {
+        return _colors;
+    }
+
+    bool VertexStreams::HasVertexColors() const {
+        return _vertexColors;
+    }
+
+    void VertexStreams::SetTexCoord(const FVector2 &texCoord) {
+        _texCoords.assign(1, texCoord);
+        _vertexTexCoords = false;
+    }
+
+    std::span<FVector2> VertexStreams::GetTexCoords() {
+        if (!_vertexTexCoords) {
+            _texCoords.resize(_positions.size(), _texCoords.front());
+            _vertexTexCoords = true;
+        }
+        return _texCoords;
+    }
+
+    std::span<const FVector2> VertexStreams::GetTexCoords() const {
+        return _texCoords;
+    }
+
+    bool VertexStreams::HasVertexTexCoords() const {
+        return _vertexTexCoords;
+    }
+
+    void VertexStreams::SetIndices(const std::span<const int> indices) {
+        _indices.assign(indices.begin(), indices.end());
+    }
+
+    void VertexStreams::Add(const int index) {
+        _indices.emplace_back(index);
+    }
+
+    void VertexStreams::Add(const std::initializer_list<int> indices) {
+        _indices.insert(_indices.end(), indices.begin(), indices.end());
+    }
+
+    std::size_t VertexStreams::VertexCount() const {
+        return _positions.size();
+    }
+
+    std::size_t VertexStreams::IndexCount() const {
+        return _indices.size();
+    }
+
+    const int *VertexStreams::Indices() const {
+        if (_indices.empty())
+            return nullptr;
+        return _indices.data();
+    }
+
+    const float *VertexStreams::PositionData() const {
+        return reinterpret_cast<const float *>(_positions.data());
+    }
+
+    int VertexStreams::PositionStride() const {
+        return sizeof(FVector2);
+    }
+
+    const SDL_FColor *VertexStreams::ColorData() const {
+        return reinterpret_cast<const SDL_FColor *>(_colors.data());
+    }
+
+    int VertexStreams::ColorStride() const {
+        return _vertexColors ? sizeof(FColor) : 0;
+    }
+
+    const float *VertexStreams::TexCoordData() const {
+        return reinterpret_cast<const float *>(_texCoords.data());
+    }
+
+    int VertexStreams::TexCoordStride() const {
+        return _vertexTexCoords ? sizeof(FVector2) : 0;
+    }
+}
@@ -0,0 +1,104 @@
+#include <SDLPP/SDLPP.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+SDL_InitFlags SDL::Init::flags = SDL_INIT_VIDEO;
+
+static std::size_t allocations = 0;
+
+void *operator new(const std::size_t size) {
+    ++allocations;
+    if (void *p = std::malloc(size != 0 ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+static void BuildFrame(SDL::FrameArena &arena) {
+    for (int batch = 0; batch < 16; ++batch) {
+        SDL::VertexBuffer vertices(&arena);
+        for (int i = 0; i < 64 + batch * 8; ++i)
+            vertices.Add(SDL::Vertex({static_cast<float>(i), static_cast<float>(batch)}, SDL::Color::Red), true);
+        vertices.Finalize();
+
+        SDL::CommandList commands(&arena);
+        commands.Draw(vertices);
+        commands.Draw(vertices);
+    }
+}
+
+static bool TestArena() {
+    SDL::FrameArena arena;
+    for (int frame = 0; frame < 3; ++frame) {
+        BuildFrame(arena);
+        arena.Reset();
+    }
+
+    const std::size_t blocks = arena.GetBlockCount();
+    for (int frame = 0; frame < 8; ++frame) {
+        const std::size_t before = allocations;
+        BuildFrame(arena);
+        arena.Reset();
+        if (allocations != before) {
+            std::printf("frame %d: %zu allocations after warm-up\n", frame, allocations - before);
+            return false;
+        }
+    }
+    if (arena.GetBlockCount() != blocks) {
+        std::printf("arena grew from %zu to %zu blocks after warm-up\n", blocks, arena.GetBlockCount());
+        return false;
+    }
+    return true;
+}
+
+static bool TestRenderer() {
+    SDL::Window window("FrameArenaTest", {64, 64});
+    SDL::Renderer renderer(window);
+    SDL::FrameArena &arena = renderer.GetFrameArena();
+
+    std::size_t blocks = 0;
+    for (int frame = 0; frame < 10; ++frame) {
+        const std::size_t before = allocations;
+        renderer.Clear(SDL::Color::Black);
+        for (int batch = 0; batch < 8; ++batch) {
+            SDL::VertexBuffer vertices(&arena);
+            for (int i = 0; i < 48 + batch * 6; ++i)
+                vertices.Add(SDL::Vertex({static_cast<float>(i), static_cast<float>(batch)}, SDL::Color::Red), true);
+            vertices.Finalize();
+            renderer.Draw(vertices);
+
+            SDL::CommandList commands(&arena);
+            commands.Draw(vertices);
+            renderer.Draw(commands);
+        }
+        if (arena.GetUsed() == 0) {
+            std::printf("frame %d: nothing was allocated from the renderer's frame arena\n", frame);
+            return false;
+        }
+        renderer.Display();
+        if (arena.GetUsed() != 0) {
+            std::printf("frame %d: Display() left %zu bytes in the frame arena\n", frame, arena.GetUsed());
+            return false;
+        }
+        if (frame == 2)
+            blocks = arena.GetBlockCount();
+        if (frame > 2 && (allocations != before || arena.GetBlockCount() != blocks)) {
+            std::printf("frame %d: %zu allocations, %zu blocks after warm-up\n", frame, allocations - before, arena.GetBlockCount());
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    return TestArena() && TestRenderer() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,34 @@
+#include <SDLPP/Matrix.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+static_assert((SDL::Matrix3x3(1, 2, 3, 4, 5, 6, 7, 8, 9) * SDL::Matrix3x3(9, 8, 7, 6, 5, 4, 3, 2, 1)).At(2, 2) == 90);
+static_assert((SDL::Matrix4x4(1, 0, 0, 2, 0, 1, 0, 3, 0, 0, 1, 4, 0, 0, 0, 1) * SDL::Matrix4x4(1, 0, 0, 5, 0, 1, 0, 6, 0, 0, 1, 7, 0, 0, 0, 1)).At(3, 2) == 11);
+static_assert(SDL::Matrix3x3(1, 2, 3, 4, 5, 6, 7, 8, 9)(1, 2) == 8);
+static_assert(SDL::Matrix4x4(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16).Transpose().At(3, 0) == 13);
+
+template <typename Matrix>
+static bool Throws(const Matrix &matrix, const std::size_t x, const std::size_t y) {
+    try {
+        (void)matrix(x, y);
+    } catch (const std::out_of_range &) {
+        return true;
+    }
+    return false;
+}
+
+int main() {
+    const SDL::FMatrix3x3 mat3 = SDL::FMatrix3x3::Identity;
+    const SDL::FMatrix4x4 mat4 = SDL::FMatrix4x4::Identity;
+    if (!Throws(mat3, 3, 0) || !Throws(mat3, 0, 3) || !Throws(mat4, 4, 0) || !Throws(mat4, 0, 4)) {
+        std::printf("operator() accepted an out of range index\n");
+        return EXIT_FAILURE;
+    }
+    if (Throws(mat3, 2, 2) || Throws(mat4, 3, 3) || mat3(2, 2) != 1 || mat4(3, 3) != 1) {
+        std::printf("operator() rejected a valid index\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}